@@ -14,17 +14,58 @@
 QT += core widgets multimedia multimediawidgets
 
 
-CONFIG += c++20
+CONFIG += c++20 thread
 
 TARGET = PhotoSmith
 TEMPLATE = app
 
 SOURCES += src/gui/photo_smith.cpp \
            src/core/filters/ImageFilters.cpp \
-           src/core/image/Image_Class.cpp
+           src/core/filters/PointOp.cpp \
+           src/core/filters/BoxBlur.cpp \
+           src/core/filters/MedianFilter.cpp \
+           src/core/filters/BilateralGrid.cpp \
+           src/core/filters/Morphology.cpp \
+           src/core/filters/Clahe.cpp \
+           src/core/filters/Dither.cpp \
+           src/core/filters/Quantizer.cpp \
+           src/core/filters/Sampler.cpp \
+           src/core/filters/WarpEngine.cpp \
+           src/core/filters/GeometricTransform.cpp \
+           src/core/filters/Resampler.cpp \
+           src/core/filters/FrameRenderer.cpp \
+           src/core/filters/Compositor.cpp \
+           src/core/filters/LinearLight.cpp \
+           src/core/pipeline/FilterPipeline.cpp \
+           src/core/parallel/ThreadPool.cpp \
+           src/core/image/Image_Class.cpp \
+           src/core/image/Histogram.cpp \
+           src/core/io/ImageEncoder.cpp
 
 HEADERS += src/core/image/Image_Class.h \
-           src/core/filters/ImageFilters.h
+           src/core/image/Histogram.h \
+           src/core/filters/ImageFilters.h \
+           src/core/filters/FilterTypes.h \
+           src/core/filters/PointOp.h \
+           src/core/filters/BoxBlur.h \
+           src/core/filters/MedianFilter.h \
+           src/core/filters/BilateralGrid.h \
+           src/core/filters/Morphology.h \
+           src/core/filters/Clahe.h \
+           src/core/filters/Dither.h \
+           src/core/filters/Quantizer.h \
+           src/core/filters/Sampler.h \
+           src/core/filters/WarpEngine.h \
+           src/core/filters/GeometricTransform.h \
+           src/core/filters/Resampler.h \
+           src/core/filters/FrameRenderer.h \
+           src/core/filters/Compositor.h \
+           src/core/filters/LinearLight.h \
+           src/core/filters/CounterRng.h \
+           src/core/pipeline/FilterPipeline.h \
+           src/core/parallel/ThreadPool.h \
+           src/core/io/ImageEncoder.h \
+           src/gui/QtFilterObserver.h
 
 FORMS += src/gui/mainwindow.ui
 
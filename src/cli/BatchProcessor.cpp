@@ -0,0 +1,180 @@
+/**
+ * @file BatchProcessor.cpp
+ * @brief Implementation of the bounded three-stage batch pipeline.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "BatchProcessor.h"
+#include "BoundedQueue.h"
+#include "FilterChain.h"
+#include "image/Image_Class.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief An image travelling between stages, tagged with its job index.
+ */
+struct WorkItem {
+    std::size_t index = 0;
+    std::unique_ptr<Image> image;
+    std::uint64_t inputPixels = 0;
+};
+
+/**
+ * @brief Starts @p count threads running @p body and closes @p next once the last
+ *        of them returns, so the downstream stage sees end-of-input exactly once.
+ */
+void startStage(std::vector<std::thread>& threads, int count, BoundedQueue<WorkItem>* next,
+                const std::function<void()>& body)
+{
+    auto remaining = std::make_shared<std::atomic<int>>(count);
+    for (int i = 0; i < count; ++i) {
+        threads.emplace_back([remaining, next, body] {
+            body();
+            if (remaining->fetch_sub(1) == 1 && next != nullptr) {
+                next->close();
+            }
+        });
+    }
+}
+
+} // namespace
+
+BatchProcessor::BatchProcessor(const FilterChain& chain, const EncodeOptions& options, int jobs)
+    : chain(chain), options(options), jobCount(jobs < 1 ? 1 : jobs)
+{
+}
+
+BatchStats BatchProcessor::run(const std::vector<BatchJob>& jobs)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const int total = static_cast<int>(jobs.size());
+
+    BoundedQueue<WorkItem> decoded(jobCount);
+    BoundedQueue<WorkItem> filtered(jobCount);
+
+    std::atomic<std::size_t> nextJob(0);
+    std::atomic<int> processed(0);
+    std::atomic<int> failed(0);
+    std::atomic<std::uint64_t> pixels(0);
+    std::atomic<std::uint64_t> bytesRead(0);
+    std::atomic<std::uint64_t> bytesWritten(0);
+
+    // Wakes the progress reporter as soon as an image finishes
+    std::mutex progressMutex;
+    std::condition_variable progressChanged;
+    auto finishItem = [&](std::atomic<int>& counter) {
+        {
+            std::lock_guard<std::mutex> lock(progressMutex);
+            counter.fetch_add(1);
+        }
+        progressChanged.notify_one();
+    };
+
+    std::mutex errorMutex;
+    auto reportError = [&](std::size_t index, const std::string& message) {
+        finishItem(failed);
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (onError) onError(jobs[index], message);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<std::size_t>(jobCount) * 3);
+
+    // Stage 1: claim the next job and decode it
+    startStage(threads, jobCount, &decoded, [&] {
+        for (std::size_t index = nextJob.fetch_add(1); index < jobs.size(); index = nextJob.fetch_add(1)) {
+            WorkItem item;
+            item.index = index;
+            try {
+                item.image = std::make_unique<Image>(jobs[index].input);
+                item.inputPixels = static_cast<std::uint64_t>(item.image->width) * item.image->height;
+            } catch (const std::exception& e) {
+                reportError(index, e.what());
+                continue;
+            }
+            if (!decoded.push(std::move(item))) return;
+        }
+    });
+
+    // Stage 2: run the filter chain
+    startStage(threads, jobCount, &filtered, [&] {
+        WorkItem item;
+        while (decoded.pop(item)) {
+            try {
+                chain.apply(*item.image);
+            } catch (const std::exception& e) {
+                reportError(item.index, e.what());
+                continue;
+            }
+            if (!filtered.push(std::move(item))) return;
+        }
+    });
+
+    // Stage 3: encode and write
+    startStage(threads, jobCount, nullptr, [&] {
+        WorkItem item;
+        while (filtered.pop(item)) {
+            const BatchJob& job = jobs[item.index];
+            try {
+                bytesWritten.fetch_add(ImageEncoder::writeFile(*item.image, job.output, job.format, options));
+                std::error_code ec;
+                const std::uintmax_t inputSize = std::filesystem::file_size(job.input, ec);
+                bytesRead.fetch_add(ec ? 0 : inputSize);
+                pixels.fetch_add(item.inputPixels);
+                finishItem(processed);
+            } catch (const std::exception& e) {
+                reportError(item.index, e.what());
+            }
+            item.image.reset();
+        }
+    });
+
+    auto snapshot = [&] {
+        BatchStats stats;
+        stats.processed = processed.load();
+        stats.failed = failed.load();
+        stats.pixels = pixels.load();
+        stats.bytesRead = bytesRead.load();
+        stats.bytesWritten = bytesWritten.load();
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return stats;
+    };
+
+    // Report progress from this thread once a second while the stages run; the last
+    // completion wakes it immediately, so the run ends as soon as the work does
+    if (onProgress) {
+        auto finished = [&] { return processed.load() + failed.load() >= total; };
+        auto nextReport = start + std::chrono::seconds(1);
+        std::unique_lock<std::mutex> lock(progressMutex);
+        while (!progressChanged.wait_until(lock, nextReport, finished)) {
+            lock.unlock();
+            onProgress(snapshot(), total);
+            lock.lock();
+            nextReport = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        }
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    BatchStats stats = snapshot();
+    if (onProgress) onProgress(stats, total);
+    return stats;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file BatchProcessor.h
+ * @brief Bounded decode -> filter -> encode pipeline for batches of image files.
+ *
+ * This file contains the declaration of the BatchProcessor class, which processes a
+ * list of input files with a FilterChain on every core. Decoding, filtering and
+ * encoding run as three stages of worker threads connected by BoundedQueue instances,
+ * so disk, codec and filter work overlap while the number of images held in memory
+ * stays bounded regardless of the batch size.
+ *
+ * @details The BatchProcessor class provides:
+ * - One thread pool per stage, each sized to the requested job count
+ * - Backpressure: a stage blocks when the next stage's queue is full
+ * - Per-image error isolation; a failed image is reported and the batch continues
+ * - Throughput statistics (images, megapixels and bytes per second)
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef BATCHPROCESSOR_H
+#define BATCHPROCESSOR_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "io/ImageEncoder.h"
+
+class FilterChain;
+
+/**
+ * @brief One input file and where its result goes.
+ */
+struct BatchJob {
+    std::string input;   ///< Path of the image to decode
+    std::string output;  ///< Path of the encoded result
+    ImageFormat format;  ///< Output format
+};
+
+/**
+ * @brief Counters describing a finished (or running) batch.
+ */
+struct BatchStats {
+    int processed = 0;                ///< Images written successfully
+    int failed = 0;                   ///< Images that could not be decoded, filtered or written
+    std::uint64_t pixels = 0;         ///< Input pixels of the processed images
+    std::uint64_t bytesRead = 0;      ///< Input file bytes of the processed images
+    std::uint64_t bytesWritten = 0;   ///< Output file bytes
+    double seconds = 0.0;             ///< Wall-clock time of the run
+};
+
+/**
+ * @class BatchProcessor
+ * @brief Runs a FilterChain over many files with a bounded three-stage pipeline.
+ *
+ * @example
+ * @code
+ * BatchProcessor processor(chain, encodeOptions, std::thread::hardware_concurrency());
+ * BatchStats stats = processor.run(jobs);
+ * @endcode
+ */
+class BatchProcessor
+{
+public:
+    /**
+     * @brief Called on the thread that runs the batch, about once per second.
+     */
+    using ProgressCallback = std::function<void(const BatchStats& stats, int total)>;
+
+    /**
+     * @brief Called from a worker thread when an image fails; calls are serialized.
+     */
+    using ErrorCallback = std::function<void(const BatchJob& job, const std::string& message)>;
+
+    /**
+     * @brief Creates a processor.
+     * @param chain Filters applied to every image (must outlive the processor)
+     * @param options Encoder settings for every output
+     * @param jobs Threads per stage (at least 1); also the capacity of each queue
+     */
+    BatchProcessor(const FilterChain& chain, const EncodeOptions& options, int jobs);
+
+    /** @brief Sets the callback receiving periodic progress. */
+    void setProgressCallback(ProgressCallback callback) { onProgress = std::move(callback); }
+
+    /** @brief Sets the callback receiving per-image errors. */
+    void setErrorCallback(ErrorCallback callback) { onError = std::move(callback); }
+
+    /**
+     * @brief Processes every job and returns once all outputs are written or failed.
+     *
+     * At most about 5 * jobs decoded images are alive at any time: one per worker
+     * in each stage plus the two full queues between them.
+     */
+    BatchStats run(const std::vector<BatchJob>& jobs);
+
+private:
+    const FilterChain& chain;
+    EncodeOptions options;
+    int jobCount;
+    ProgressCallback onProgress;
+    ErrorCallback onError;
+};
+
+#endif // BATCHPROCESSOR_H
@@ -0,0 +1,91 @@
+/**
+ * @file BoundedQueue.h
+ * @brief Blocking multi-producer, multi-consumer queue with a fixed capacity.
+ *
+ * The batch pipeline connects its decode, filter and encode stages with these
+ * queues. A full queue blocks its producers, which is what keeps a fast decoder from
+ * buffering thousands of images in memory while the filters catch up.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/**
+ * @class BoundedQueue
+ * @brief Blocking FIFO that holds at most a fixed number of items.
+ *
+ * Producers call push() and finally close(); consumers call pop() until it returns
+ * false, which happens once the queue is closed and drained.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    /**
+     * @brief Creates a queue.
+     * @param capacity Maximum number of queued items (at least 1)
+     */
+    explicit BoundedQueue(std::size_t capacity) : capacity(capacity < 1 ? 1 : capacity) {}
+
+    /**
+     * @brief Appends an item, blocking while the queue is full.
+     * @return false if the queue was closed; the item is then dropped
+     */
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [&] { return closed || items.size() < capacity; });
+        if (closed) return false;
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest item, blocking while the queue is empty and open.
+     * @return false once the queue is closed and empty
+     */
+    bool pop(T& item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [&] { return closed || !items.empty(); });
+        if (items.empty()) return false;
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Stops accepting items and wakes every waiting thread.
+     */
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+
+private:
+    const std::size_t capacity;
+    std::deque<T> items;
+    std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    bool closed = false;
+};
+
+#endif // BOUNDEDQUEUE_H
@@ -0,0 +1,798 @@
+/**
+ * @file FilterChain.cpp
+ * @brief Implementation of command-line filter chain parsing.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "FilterChain.h"
+#include "filters/Compositor.h"
+#include "filters/FilterTypes.h"
+#include "filters/FrameRenderer.h"
+#include "filters/GeometricTransform.h"
+#include "filters/ImageFilters.h"
+#include "filters/PointOp.h"
+#include "image/Image_Class.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Turns the "Filter failed: ..." status of ImageFilters into an error.
+ */
+class FailureObserver : public FilterObserver
+{
+public:
+    void statusChanged(const std::string& message) override
+    {
+        if (message.rfind("Filter failed: ", 0) == 0) {
+            failure = message;
+        }
+    }
+
+    std::string failure;
+};
+
+/**
+ * @brief ImageFilters call made by a full-frame stage. The saved image and the
+ *        cancellation flag feed the cancellable overloads; a batch never cancels.
+ */
+using FilterCall = std::function<void(ImageFilters& filters, Image& image, Image& saved, std::atomic<bool>& cancel)>;
+
+FilterPipeline::FrameKernel viaImageFilters(WorkingSpace space, FilterCall call)
+{
+    return [space, call](Image& image) {
+        FailureObserver observer;
+        ImageFilters filters(&observer);
+        filters.setWorkingSpace(space);
+        Image saved;
+        std::atomic<bool> cancel(false);
+        call(filters, image, saved, cancel);
+        if (!observer.failure.empty()) {
+            throw std::runtime_error(observer.failure);
+        }
+    };
+}
+
+struct FilterSpec {
+    std::string name;
+    std::vector<std::string> args;
+};
+
+FilterSpec splitSpec(const std::string& spec)
+{
+    FilterSpec result;
+    const std::size_t colon = spec.find(':');
+    result.name = spec.substr(0, colon);
+    std::transform(result.name.begin(), result.name.end(), result.name.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (colon != std::string::npos) {
+        std::stringstream rest(spec.substr(colon + 1));
+        std::string arg;
+        while (std::getline(rest, arg, ',')) {
+            result.args.push_back(arg);
+        }
+    }
+    return result;
+}
+
+void expectArgs(const FilterSpec& spec, std::size_t minCount, std::size_t maxCount)
+{
+    if (spec.args.size() < minCount || spec.args.size() > maxCount) {
+        throw std::invalid_argument("Wrong number of parameters for filter '" + spec.name + "'");
+    }
+}
+
+int parseInt(const FilterSpec& spec, std::size_t index, int fallback, int minValue, int maxValue)
+{
+    if (index >= spec.args.size()) return fallback;
+    const std::string& text = spec.args[index];
+    std::size_t used = 0;
+    int value = 0;
+    try {
+        value = std::stoi(text, &used);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used == 0 || used != text.size() || value < minValue || value > maxValue) {
+        throw std::invalid_argument("Invalid parameter '" + text + "' for filter '" + spec.name + "' (expected "
+                                    + std::to_string(minValue) + ".." + std::to_string(maxValue) + ")");
+    }
+    return value;
+}
+
+double parseDouble(const FilterSpec& spec, std::size_t index, double minValue, double maxValue)
+{
+    const std::string& text = spec.args[index];
+    std::size_t used = 0;
+    double value = 0.0;
+    try {
+        value = std::stod(text, &used);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used == 0 || used != text.size() || !(value >= minValue && value <= maxValue)) {
+        std::ostringstream range;
+        range << minValue << ".." << maxValue;
+        throw std::invalid_argument("Invalid parameter '" + text + "' for filter '" + spec.name + "' (expected "
+                                    + range.str() + ")");
+    }
+    return value;
+}
+
+/**
+ * @brief Sampling, canvas and fill options shared by the geometric filters.
+ */
+struct GeometryOptions {
+    Interpolation interpolation = Interpolation::Bilinear;
+    RotateCanvas canvas = RotateCanvas::Expand;
+    EdgeMode edge = EdgeMode::Constant;
+    RgbColor background;
+    bool fitOutput = true;
+};
+
+/**
+ * @brief Parses a #RRGGBB color; returns false if @p text is not one.
+ */
+bool parseColor(const std::string& text, RgbColor& color)
+{
+    if (text.size() != 7 || text[0] != '#'
+        || text.find_first_not_of("0123456789abcdefABCDEF", 1) != std::string::npos) {
+        return false;
+    }
+    const unsigned long rgb = std::stoul(text.substr(1), nullptr, 16);
+    color.r = static_cast<unsigned char>(rgb >> 16);
+    color.g = static_cast<unsigned char>(rgb >> 8);
+    color.b = static_cast<unsigned char>(rgb);
+    return true;
+}
+
+/**
+ * @brief Parses the option keywords from argument @p first on: a sampling mode, a
+ *        #RRGGBB fill, and either rotate canvases or transform edge modes.
+ */
+GeometryOptions parseGeometryOptions(const FilterSpec& spec, std::size_t first, bool rotate)
+{
+    GeometryOptions options;
+    for (std::size_t i = first; i < spec.args.size(); ++i) {
+        const std::string& arg = spec.args[i];
+        if (arg == "nearest") options.interpolation = Interpolation::Nearest;
+        else if (arg == "bilinear") options.interpolation = Interpolation::Bilinear;
+        else if (arg == "bicubic") options.interpolation = Interpolation::Bicubic;
+        else if (rotate && arg == "expand") options.canvas = RotateCanvas::Expand;
+        else if (rotate && arg == "original") options.canvas = RotateCanvas::Original;
+        else if (rotate && arg == "crop") options.canvas = RotateCanvas::CropToFit;
+        else if (!rotate && arg == "constant") options.edge = EdgeMode::Constant;
+        else if (!rotate && arg == "clamp") options.edge = EdgeMode::Clamp;
+        else if (!rotate && arg == "reflect") options.edge = EdgeMode::Reflect;
+        else if (!rotate && arg == "keep") options.fitOutput = false;
+        else if (!parseColor(arg, options.background)) {
+            throw std::invalid_argument("Unknown " + spec.name + " option '" + arg + "'");
+        }
+    }
+    return options;
+}
+
+/**
+ * @brief Adds affine:A,B,C,D,E,F or homography:H0..H8, each followed by options.
+ */
+void addTransform(FilterPipeline& pipeline, const FilterSpec& spec, WorkingSpace space)
+{
+    const std::size_t count = spec.name == "affine" ? 6 : 9;
+    if (spec.args.size() < count) {
+        throw std::invalid_argument("Wrong number of parameters for filter '" + spec.name + "'");
+    }
+    std::array<double, 9> m = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0};
+    for (std::size_t i = 0; i < count; ++i) {
+        m[i] = parseDouble(spec, i, -1e6, 1e6);
+    }
+    const GeometricTransform transform = GeometricTransform::homography(m);
+    const GeometryOptions options = parseGeometryOptions(spec, count, false);
+    pipeline.frame(spec.name, viaImageFilters(space, [transform, options](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+        f.applyTransform(img, transform, options.interpolation, options.edge, options.background, options.fitOutput);
+    }));
+}
+
+/**
+ * @brief Adds perspective:X0,Y0,...,X3,Y3[,WxH][,SAMPLING] (corners clockwise from top-left).
+ */
+void addPerspective(FilterPipeline& pipeline, const FilterSpec& spec, WorkingSpace space)
+{
+    if (spec.args.size() < 8) {
+        throw std::invalid_argument("Wrong number of parameters for filter 'perspective'");
+    }
+    std::array<double, 8> corners;
+    for (std::size_t i = 0; i < 8; ++i) {
+        corners[i] = parseDouble(spec, i, -1e6, 1e6);
+    }
+    int width = 0;
+    int height = 0;
+    FilterSpec rest{spec.name, std::vector<std::string>(spec.args.begin() + 8, spec.args.end())};
+    if (!rest.args.empty() && rest.args[0].find('x') != std::string::npos) {
+        const std::string size = rest.args[0];
+        FilterSpec dimensions{spec.name, {size.substr(0, size.find('x')), size.substr(size.find('x') + 1)}};
+        width = parseInt(dimensions, 0, 0, 1, 32768);
+        height = parseInt(dimensions, 1, 0, 1, 32768);
+        rest.args.erase(rest.args.begin());
+    }
+    GeometryOptions options;
+    options.interpolation = Interpolation::Bicubic;
+    if (!rest.args.empty()) {
+        expectArgs(rest, 1, 1);
+        options = parseGeometryOptions(rest, 0, false);
+        if (options.edge != EdgeMode::Constant || !options.fitOutput) {
+            throw std::invalid_argument("Perspective only takes a sampling option");
+        }
+    }
+    const Interpolation interpolation = options.interpolation;
+    pipeline.frame(spec.name, viaImageFilters(space, [corners, width, height, interpolation](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+        f.applyPerspectiveCorrect(img, corners, width, height, interpolation);
+    }));
+}
+
+ResizeFilter parseResizeFilter(const std::string& name)
+{
+    if (name == "nearest") return ResizeFilter::Nearest;
+    if (name == "bilinear") return ResizeFilter::Bilinear;
+    if (name == "bicubic") return ResizeFilter::Bicubic;
+    if (name == "lanczos") return ResizeFilter::Lanczos;
+    if (name == "area") return ResizeFilter::Area;
+    throw std::invalid_argument("Unknown resize filter '" + name + "'");
+}
+
+/**
+ * @brief Command-line names of the frame styles.
+ */
+struct FrameName {
+    const char* name;
+    FrameStyle style;
+};
+
+const FrameName frameNames[] = {
+    {"simple", FrameStyle::Simple},
+    {"double-white", FrameStyle::DoubleWhite},
+    {"blue", FrameStyle::SolidBlue},
+    {"red", FrameStyle::SolidRed},
+    {"green", FrameStyle::SolidGreen},
+    {"black", FrameStyle::SolidBlack},
+    {"white", FrameStyle::SolidWhite},
+    {"shadow", FrameStyle::Shadow},
+    {"gold", FrameStyle::GoldDecorated},
+    {"decorated", FrameStyle::Decorated},
+};
+
+/**
+ * @brief Parses frame:STYLE, or frame:WIDTH,#RRGGBB followed by INSET+THICKNESS#RRGGBB bands.
+ */
+FrameSpec parseFrame(const FilterSpec& spec)
+{
+    if (spec.args.size() == 1) {
+        for (const FrameName& entry : frameNames) {
+            if (spec.args[0] == entry.name) return FrameSpec::fromStyle(entry.style);
+        }
+        throw std::invalid_argument("Unknown frame style '" + spec.args[0] + "'");
+    }
+    if (spec.args.size() < 2) {
+        throw std::invalid_argument("Wrong number of parameters for filter '" + spec.name + "'");
+    }
+
+    RgbColor color;
+    if (!parseColor(spec.args[1], color)) {
+        throw std::invalid_argument("Invalid frame color '" + spec.args[1] + "' (expected #RRGGBB)");
+    }
+    FrameSpec frame = FrameSpec::solid(parseInt(spec, 0, 0, 0, 10000), color);
+    for (std::size_t i = 2; i < spec.args.size(); ++i) {
+        const std::string& arg = spec.args[i];
+        const std::size_t plus = arg.find('+');
+        const std::size_t hash = arg.find('#');
+        FrameBand band;
+        if (plus == std::string::npos || hash == std::string::npos || hash < plus
+            || !parseColor(arg.substr(hash), band.color)) {
+            throw std::invalid_argument("Invalid frame band '" + arg + "' (expected INSET+THICKNESS#RRGGBB)");
+        }
+        const FilterSpec numbers{spec.name, {arg.substr(0, plus), arg.substr(plus + 1, hash - plus - 1)}};
+        band.inset = parseInt(numbers, 0, 0, 0, 10000);
+        band.thickness = parseInt(numbers, 1, 0, 0, 10000);
+        frame.bands.push_back(band);
+    }
+    return frame;
+}
+
+/**
+ * @brief Command-line names of the blend modes and anchors.
+ */
+struct BlendModeName {
+    const char* name;
+    BlendMode mode;
+};
+
+const BlendModeName blendModeNames[] = {
+    {"normal", BlendMode::Normal},
+    {"multiply", BlendMode::Multiply},
+    {"screen", BlendMode::Screen},
+    {"overlay", BlendMode::Overlay},
+    {"add", BlendMode::Add},
+    {"difference", BlendMode::Difference},
+};
+
+struct AnchorName {
+    const char* name;
+    Anchor anchor;
+};
+
+const AnchorName anchorNames[] = {
+    {"top-left", Anchor::TopLeft},
+    {"top", Anchor::Top},
+    {"top-right", Anchor::TopRight},
+    {"left", Anchor::Left},
+    {"center", Anchor::Center},
+    {"right", Anchor::Right},
+    {"bottom-left", Anchor::BottomLeft},
+    {"bottom", Anchor::Bottom},
+    {"bottom-right", Anchor::BottomRight},
+};
+
+struct MorphologyName {
+    const char* name;
+    MorphologyOp op;
+};
+
+const MorphologyName morphologyNames[] = {
+    {"erode", MorphologyOp::Erode},
+    {"dilate", MorphologyOp::Dilate},
+    {"open", MorphologyOp::Open},
+    {"close", MorphologyOp::Close},
+    {"gradient", MorphologyOp::Gradient},
+};
+
+struct BinarizeName {
+    const char* name;
+    BinarizeMode mode;
+};
+
+const BinarizeName binarizeNames[] = {
+    {"otsu", BinarizeMode::Otsu},
+    {"bayer", BinarizeMode::Bayer},
+    {"floyd-steinberg", BinarizeMode::FloydSteinberg},
+};
+
+struct QuantizeName {
+    const char* name;
+    QuantizeMethod method;
+};
+
+const QuantizeName quantizeNames[] = {
+    {"kmeans", QuantizeMethod::KMeans},
+    {"median-cut", QuantizeMethod::MedianCut},
+};
+
+/**
+ * @brief Entry of a name table matching @p name, or null.
+ */
+template <class Entry, std::size_t Count>
+const Entry* findName(const Entry (&table)[Count], const std::string& name)
+{
+    for (const Entry& entry : table) {
+        if (name == entry.name) return &entry;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Adds merge:PATH followed by resize|overlap, a blend mode, an anchor,
+ *        opacity=PERCENT, x=DX, y=DY and mask=PATH in any order.
+ */
+void addMerge(FilterPipeline& pipeline, const FilterSpec& spec, WorkingSpace space)
+{
+    if (spec.args.empty()) {
+        throw std::invalid_argument("Wrong number of parameters for filter '" + spec.name + "'");
+    }
+
+    // Plain merge:PATH keeps the 50% average; an explicit blend mode defaults to full opacity
+    CompositeOptions options;
+    bool modeGiven = false;
+    bool placed = false;
+    int resizeChoice = -1; // -1: not given, 0: overlap, 1: resize
+    int opacityPercent = -1;
+    std::string maskPath;
+    for (std::size_t i = 1; i < spec.args.size(); ++i) {
+        const std::string& arg = spec.args[i];
+        const std::size_t equals = arg.find('=');
+        const std::string key = equals == std::string::npos ? std::string() : arg.substr(0, equals);
+        const FilterSpec value{spec.name, {equals == std::string::npos ? std::string() : arg.substr(equals + 1)}};
+        if (arg == "resize") resizeChoice = 1;
+        else if (arg == "overlap") resizeChoice = 0;
+        else if (key == "opacity") opacityPercent = parseInt(value, 0, 0, 0, 100);
+        else if (key == "x") { options.offsetX = parseInt(value, 0, 0, -100000, 100000); placed = true; }
+        else if (key == "y") { options.offsetY = parseInt(value, 0, 0, -100000, 100000); placed = true; }
+        else if (key == "mask") maskPath = value.args[0];
+        else if (const BlendModeName* mode = findName(blendModeNames, arg)) { options.mode = mode->mode; modeGiven = true; }
+        else if (const AnchorName* anchor = findName(anchorNames, arg)) { options.anchor = anchor->anchor; placed = true; }
+        else throw std::invalid_argument("Unknown merge option '" + arg + "'");
+    }
+    options.opacity = opacityPercent >= 0 ? opacityPercent / 100.0 : modeGiven ? 1.0 : 0.5;
+    // Positioned overlays (watermarks) keep their size unless 'resize' is asked for
+    const bool resizeToLarger = resizeChoice >= 0 ? resizeChoice == 1 : !placed;
+
+    // Loaded once and shared read-only by every worker
+    auto overlay = std::make_shared<const Image>(spec.args[0]);
+    std::shared_ptr<const Image> mask;
+    if (!maskPath.empty()) {
+        mask = std::make_shared<const Image>(maskPath);
+        if (mask->width != overlay->width || mask->height != overlay->height) {
+            throw std::invalid_argument("Merge mask '" + maskPath + "' must have the size of the overlay");
+        }
+    }
+    pipeline.frame("merge", viaImageFilters(space, [overlay, mask, options, resizeToLarger](ImageFilters& filters, Image& image, Image&, std::atomic<bool>&) {
+        // Same choice as the GUI's "Resize smaller image to match larger"
+        if (resizeToLarger && (overlay->width != image.width || overlay->height != image.height)) {
+            const int targetW = std::max(image.width, overlay->width);
+            const int targetH = std::max(image.height, overlay->height);
+            if (image.width != targetW || image.height != targetH) {
+                filters.applyResize(image, targetW, targetH, ResizeFilter::Bicubic);
+            }
+            Image mergeImage = *overlay;
+            CompositeOptions resized = options;
+            Image mergeMask;
+            if (mergeImage.width != targetW || mergeImage.height != targetH) {
+                filters.applyResize(mergeImage, targetW, targetH, ResizeFilter::Bicubic);
+            }
+            if (mask) {
+                mergeMask = *mask;
+                if (mergeMask.width != targetW || mergeMask.height != targetH) {
+                    filters.applyResize(mergeMask, targetW, targetH, ResizeFilter::Bicubic);
+                }
+                resized.mask = &mergeMask;
+            }
+            filters.applyMerge(image, mergeImage, resized);
+            return;
+        }
+        CompositeOptions placement = options;
+        placement.mask = mask.get();
+        filters.applyMerge(image, *overlay, placement);
+    }));
+}
+
+void addFilter(FilterPipeline& pipeline, const FilterSpec& spec, WorkingSpace space)
+{
+    const std::string& name = spec.name;
+
+    // Point and stencil filters fuse into banded passes
+    if (name == "grayscale") { expectArgs(spec, 0, 0); pipeline.grayscale(); return; }
+    if (name == "invert") { expectArgs(spec, 0, 0); pipeline.point(PointOp::invert()); return; }
+    if (name == "purple") { expectArgs(spec, 0, 0); pipeline.point(PointOp::purple()); return; }
+    if (name == "sunlight") { expectArgs(spec, 0, 0); pipeline.point(PointOp::sunlight()); return; }
+    if (name == "emboss") { expectArgs(spec, 0, 0); pipeline.emboss(); return; }
+    if (name == "darken" || name == "lighten") {
+        expectArgs(spec, 0, 1);
+        pipeline.point(PointOp::darkAndLight(name == "darken", parseInt(spec, 0, 50, 0, 100), space));
+        return;
+    }
+    if (name == "black-white") {
+        // A fixed threshold fuses; Otsu and the dithers need the whole frame
+        expectArgs(spec, 0, 1);
+        const BinarizeName* binarize = spec.args.empty() ? nullptr : findName(binarizeNames, spec.args[0]);
+        if (!binarize) {
+            pipeline.blackAndWhite(parseInt(spec, 0, 127, 0, 255));
+            return;
+        }
+        const BinarizeMode mode = binarize->mode;
+        pipeline.frame(name, viaImageFilters(space, [mode](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyBlackAndWhite(img, saved, cancel, mode);
+        }));
+        return;
+    }
+
+    // Everything else runs as a full-frame ImageFilters call
+    if (name == "tv") {
+        // Fixed default seed so batch output is reproducible
+        expectArgs(spec, 0, 1);
+        const int seed = parseInt(spec, 0, 0, 0, std::numeric_limits<int>::max());
+        pipeline.frame(name, viaImageFilters(space, [seed](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyTVFilter(img, saved, cancel, static_cast<std::uint64_t>(seed));
+        }));
+    } else if (name == "infrared") {
+        expectArgs(spec, 0, 0);
+        pipeline.frame(name, viaImageFilters(space, [](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyInfrared(img, saved, cancel);
+        }));
+    } else if (name == "blur") {
+        expectArgs(spec, 0, 1);
+        const int strength = parseInt(spec, 0, 60, 0, 100);
+        pipeline.frame(name, viaImageFilters(space, [strength](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyBlur(img, saved, cancel, strength);
+        }));
+    } else if (name == "unsharp") {
+        expectArgs(spec, 0, 3);
+        const int amount = parseInt(spec, 0, 100, 0, 500);
+        const int radius = parseInt(spec, 1, 2, 1, 50);
+        const int threshold = parseInt(spec, 2, 0, 0, 255);
+        pipeline.frame(name, viaImageFilters(space, [amount, radius, threshold](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyUnsharpMask(img, saved, cancel, amount, radius, threshold);
+        }));
+    } else if (name == "high-pass") {
+        expectArgs(spec, 0, 2);
+        const int amount = parseInt(spec, 0, 100, 0, 500);
+        const int radius = parseInt(spec, 1, 3, 1, 50);
+        pipeline.frame(name, viaImageFilters(space, [amount, radius](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyHighPass(img, saved, cancel, amount, radius);
+        }));
+    } else if (name == "median") {
+        expectArgs(spec, 0, 1);
+        const int radius = parseInt(spec, 0, 1, 1, 50);
+        pipeline.frame(name, viaImageFilters(space, [radius](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyMedian(img, saved, cancel, radius);
+        }));
+    } else if (name == "bilateral") {
+        expectArgs(spec, 0, 2);
+        const double spatial = spec.args.size() > 0 ? parseDouble(spec, 0, 2.0, 500.0) : 8.0;
+        const double range = spec.args.size() > 1 ? parseDouble(spec, 1, 2.0, 255.0) : 20.0;
+        pipeline.frame(name, viaImageFilters(space, [spatial, range](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyBilateral(img, saved, cancel, spatial, range);
+        }));
+    } else if (const MorphologyName* morphology = findName(morphologyNames, name)) {
+        // Accept "erode:5" (square), "erode:5x3" and "erode:5,3"
+        FilterSpec size = spec;
+        if (!size.args.empty()) {
+            const std::size_t x = size.args[0].find('x');
+            if (x != std::string::npos) {
+                const std::string dimensions = size.args[0];
+                size.args[0] = dimensions.substr(x + 1);
+                size.args.insert(size.args.begin(), dimensions.substr(0, x));
+            }
+        }
+        expectArgs(size, 0, 2);
+        const int width = parseInt(size, 0, 3, 1, 255);
+        const int height = parseInt(size, 1, width, 1, 255);
+        const MorphologyOp op = morphology->op;
+        pipeline.frame(name, viaImageFilters(space, [op, width, height](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyMorphology(img, saved, cancel, op, width, height);
+        }));
+    } else if (name == "equalize") {
+        expectArgs(spec, 0, 0);
+        pipeline.frame(name, viaImageFilters(space, [](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyEqualize(img, saved, cancel);
+        }));
+    } else if (name == "clahe") {
+        // Accept "clahe:2,8" (8x8 tiles), "clahe:2,8x4" and "clahe:2,8,4"
+        FilterSpec grid = spec;
+        if (grid.args.size() > 1) {
+            const std::size_t x = grid.args[1].find('x');
+            if (x != std::string::npos) {
+                const std::string tiles = grid.args[1];
+                grid.args[1] = tiles.substr(0, x);
+                grid.args.insert(grid.args.begin() + 2, tiles.substr(x + 1));
+            }
+        }
+        expectArgs(grid, 0, 3);
+        const double clip = grid.args.size() > 0 ? parseDouble(grid, 0, 0.0, 100.0) : 2.0;
+        const int tilesX = parseInt(grid, 1, 8, 1, 64);
+        const int tilesY = parseInt(grid, 2, tilesX, 1, 64);
+        pipeline.frame(name, viaImageFilters(space, [clip, tilesX, tilesY](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyClahe(img, saved, cancel, tilesX, tilesY, clip);
+        }));
+    } else if (name == "quantize") {
+        // "quantize:16", "quantize:16,median-cut", "quantize:16,dither" or both options
+        expectArgs(spec, 0, 3);
+        const int colors = parseInt(spec, 0, 256, 2, 256);
+        QuantizeMethod method = QuantizeMethod::KMeans;
+        bool dither = false;
+        for (std::size_t i = 1; i < spec.args.size(); ++i) {
+            if (const QuantizeName* quantize = findName(quantizeNames, spec.args[i])) {
+                method = quantize->method;
+            } else if (spec.args[i] == "dither") {
+                dither = true;
+            } else {
+                throw std::invalid_argument("Unknown " + name + " option '" + spec.args[i] + "'");
+            }
+        }
+        pipeline.frame(name, viaImageFilters(space, [colors, method, dither](ImageFilters& f, Image& img, Image& saved, std::atomic<bool>& cancel) {
+            f.applyQuantize(img, saved, cancel, colors, method, dither);
+        }));
+    } else if (name == "edges") {
+        expectArgs(spec, 0, 0);
+        pipeline.frame(name, viaImageFilters(space, [](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyEdges(img);
+        }));
+    } else if (name == "canny") {
+        expectArgs(spec, 0, 2);
+        const int low = parseInt(spec, 0, 50, 0, 2048);
+        const int high = parseInt(spec, 1, std::max(100, low), low, 2048);
+        pipeline.frame(name, viaImageFilters(space, [low, high](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyCanny(img, low, high);
+        }));
+    } else if (name == "fisheye") {
+        expectArgs(spec, 0, 0);
+        pipeline.frame(name, viaImageFilters(space, [](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyFishEye(img);
+        }));
+    } else if (name == "double-vision") {
+        expectArgs(spec, 0, 1);
+        const int offset = parseInt(spec, 0, 15, 0, 10000);
+        pipeline.frame(name, viaImageFilters(space, [offset](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyDoubleVision(img, offset);
+        }));
+    } else if (name == "oil-painting") {
+        expectArgs(spec, 0, 2);
+        const int radius = parseInt(spec, 0, 3, 1, 50);
+        const int intensity = parseInt(spec, 1, 30, 1, 256);
+        pipeline.frame(name, viaImageFilters(space, [radius, intensity](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyOilPainting(img, radius, intensity);
+        }));
+    } else if (name == "flip") {
+        expectArgs(spec, 1, 1);
+        FlipDirection direction;
+        if (spec.args[0] == "h" || spec.args[0] == "horizontal") direction = FlipDirection::Horizontal;
+        else if (spec.args[0] == "v" || spec.args[0] == "vertical") direction = FlipDirection::Vertical;
+        else throw std::invalid_argument("Flip direction must be 'h' or 'v'");
+        pipeline.frame(name, viaImageFilters(space, [direction](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyFlip(img, direction);
+        }));
+    } else if (name == "rotate") {
+        expectArgs(spec, 1, 4);
+        const double degrees = parseDouble(spec, 0, -360.0, 360.0);
+        const GeometryOptions options = parseGeometryOptions(spec, 1, true);
+        pipeline.frame(name, viaImageFilters(space, [degrees, options](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyRotate(img, degrees, options.interpolation, options.canvas, options.background);
+        }));
+    } else if (name == "affine" || name == "homography") {
+        addTransform(pipeline, spec, space);
+    } else if (name == "perspective") {
+        addPerspective(pipeline, spec, space);
+    } else if (name == "frame") {
+        const FrameSpec frame = parseFrame(spec);
+        pipeline.frame(name, viaImageFilters(space, [frame](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyFrame(img, frame);
+        }));
+    } else if (name == "resize") {
+        // Accept both "resize:800x600[,FILTER]" and "resize:800,600[,FILTER]"
+        FilterSpec size = spec;
+        if (!size.args.empty()) {
+            const std::size_t x = size.args[0].find('x');
+            if (x != std::string::npos) {
+                const std::string dimensions = size.args[0];
+                size.args[0] = dimensions.substr(x + 1);
+                size.args.insert(size.args.begin(), dimensions.substr(0, x));
+            }
+        }
+        expectArgs(size, 2, 3);
+        const int width = parseInt(size, 0, 0, 1, 65535);
+        const int height = parseInt(size, 1, 0, 1, 65535);
+        const ResizeFilter filter = size.args.size() == 3 ? parseResizeFilter(size.args[2]) : ResizeFilter::Nearest;
+        pipeline.frame(name, viaImageFilters(space, [width, height, filter](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applyResize(img, width, height, filter);
+        }));
+    } else if (name == "skew") {
+        expectArgs(spec, 0, 1);
+        const int angle = parseInt(spec, 0, 40, -60, 60);
+        pipeline.frame(name, viaImageFilters(space, [angle](ImageFilters& f, Image& img, Image&, std::atomic<bool>&) {
+            f.applySkew(img, angle);
+        }));
+    } else if (name == "merge") {
+        addMerge(pipeline, spec, space);
+    } else {
+        throw std::invalid_argument("Unknown filter '" + name + "' (see --list-filters)");
+    }
+}
+
+} // namespace
+
+FilterChain FilterChain::parse(const std::vector<std::string>& specs, WorkingSpace space)
+{
+    FilterChain chain;
+    for (const std::string& text : specs) {
+        addFilter(chain.pipeline, splitSpec(text), space);
+        chain.specs.push_back(text);
+    }
+    return chain;
+}
+
+void FilterChain::apply(Image& image) const
+{
+    if (pipeline.empty()) return;
+    pipeline.run(image);
+}
+
+std::string FilterChain::describe() const
+{
+    if (specs.empty()) return "(none)";
+    std::string text;
+    for (std::size_t i = 0; i < specs.size(); ++i) {
+        if (i > 0) text += " -> ";
+        text += specs[i];
+    }
+    return text;
+}
+
+std::string FilterChain::usage()
+{
+    std::string text =
+        "Filters (applied in the order given; defaults match the GUI dialogs):\n"
+        "  grayscale                 average of R, G and B\n"
+        "  black-white[:MODE]        pure black and white; MODE is a threshold (0-255,\n"
+        "                            default 127), otsu (automatic threshold), bayer\n"
+        "                            (ordered dither) or floyd-steinberg (error diffusion)\n"
+        "  invert                    negative image\n"
+        "  purple                    purple tint\n"
+        "  sunlight                  warm sunlight tone\n"
+        "  darken[:PERCENT]          darken by PERCENT (0-100, default 50)\n"
+        "  lighten[:PERCENT]         lighten by PERCENT (0-100, default 50)\n"
+        "  emboss                    emboss relief\n"
+        "  tv[:SEED]                 TV/CRT scan lines and noise; the same SEED (default 0)\n"
+        "                            always gives the same grain\n"
+        "  infrared                  infrared photography look\n"
+        "  blur[:STRENGTH]           box blur (0-100, default 60)\n"
+        "  unsharp[:A,R,T]           unsharp mask: amount A% (0-500, default 100), radius R\n"
+        "                            (1-50, default 2), threshold T (0-255, default 0)\n"
+        "  high-pass[:A,R]           high-pass overlay sharpening, amount A% (0-500,\n"
+        "                            default 100), radius R (1-50, default 3)\n"
+        "  median[:RADIUS]           per-channel median of a (2R+1)^2 window, removes\n"
+        "                            salt-and-pepper noise (1-50, default 1)\n"
+        "  bilateral[:SPATIAL,RANGE] edge-preserving smoothing; Gaussian widths in pixels\n"
+        "                            (2-500, default 8) and brightness levels (2-255,\n"
+        "                            default 20)\n"
+        "  erode|dilate|open|close|gradient[:W[xH]]\n"
+        "                            morphology with a W x H rectangle (1-255, default\n"
+        "                            3x3; H defaults to W); after black-white, open\n"
+        "                            removes specks and close fills gaps in strokes\n"
+        "  equalize                  histogram equalization of the gray levels\n"
+        "  clahe[:CLIP[,N[xM]]]      local equalization on N x M tiles (1-64, default\n"
+        "                            8x8; M defaults to N), contrast limit CLIP (0-100,\n"
+        "                            default 2; 0 = unlimited)\n"
+        "  quantize[:N[,OPTIONS]]    reduce to N colors (2-256, default 256); OPTIONS:\n"
+        "                            kmeans|median-cut (default kmeans), dither; pair\n"
+        "                            with --png8 for indexed PNG output\n"
+        "  edges                     edge detection sketch\n"
+        "  canny[:LOW,HIGH]          thin Canny edges, hysteresis thresholds\n"
+        "                            (default 50,100)\n"
+        "  fisheye                   fish-eye lens distortion\n"
+        "  double-vision[:OFFSET]    ghosted copy OFFSET pixels away (default 15)\n"
+        "  oil-painting[:R,I]        radius R (default 3), intensity levels I (default 30)\n"
+        "  flip:h|v                  mirror horizontally or vertically\n"
+        "  rotate:DEG[,OPTIONS]      clockwise rotation by DEG degrees (-360-360); OPTIONS:\n"
+        "                            nearest|bilinear|bicubic (default bilinear),\n"
+        "                            expand|original|crop (default expand), #RRGGBB fill\n"
+        "                            (default #FFFFFF); 90, 180 and 270 are lossless\n"
+        "  affine:A,B,C,D,E,F[,OPT]  x' = Ax + By + C, y' = Dx + Ey + F; OPT: sampling as\n"
+        "                            for rotate, constant|clamp|reflect edges, #RRGGBB,\n"
+        "                            keep (input canvas instead of the bounding box)\n"
+        "  homography:H0,...,H8[,OPT] 3x3 projective matrix, row-major; OPT as for affine\n"
+        "  perspective:X0,Y0,...,X3,Y3[,WxH][,SAMPLING]\n"
+        "                            rectify the quad with corners top-left, top-right,\n"
+        "                            bottom-right, bottom-left (default bicubic)\n"
+        "  resize:WxH[,FILTER]       resize to W x H pixels; FILTER one of nearest (default),\n"
+        "                            bilinear, bicubic, lanczos, area\n"
+        "  skew[:DEGREES]            horizontal skew (-60..60, default 40)\n"
+        "  merge:PATH[,OPTIONS]      blend PATH onto the image; OPTIONS in any order:\n"
+        "                            normal|multiply|screen|overlay|add|difference,\n"
+        "                            opacity=PERCENT (default 50 without a mode, else 100),\n"
+        "                            top-left|top|top-right|left|center|right|\n"
+        "                            bottom-left|bottom|bottom-right (default top-left),\n"
+        "                            x=DX, y=DY (pixel offset), mask=PATH (alpha image of\n"
+        "                            the overlay's size), resize|overlap: resize the\n"
+        "                            smaller image to the larger one (default unless an\n"
+        "                            anchor or offset is given) or keep both sizes\n"
+        "  frame:STYLE               decorative frame, STYLE one of:\n"
+        "                           ";
+    for (const FrameName& entry : frameNames) {
+        text += ' ';
+        text += entry.name;
+    }
+    text += "\n"
+        "  frame:W,#RRGGBB[,BAND...] W-pixel frame in one color; each BAND is\n"
+        "                            INSET+THICKNESS#RRGGBB, a ring INSET pixels from the\n"
+        "                            outer edge (bands may reach into the picture)\n";
+    return text;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file FilterChain.h
+ * @brief Ordered filter chain parsed from command-line specifications.
+ *
+ * This file contains the declaration of the FilterChain class used by photosmith-cli.
+ * Each "--filter" argument names one filter and its parameters, for example
+ * "blur:60", "rotate:90", "resize:800x600" or "frame:gold". The chain is validated
+ * completely before any image is processed and compiles into a FilterPipeline, so
+ * consecutive point filters fuse into a single pass exactly as in the GUI pipeline.
+ *
+ * @details Parameters that are omitted take the defaults the GUI offers in its dialogs
+ * (blur strength 60, brightness 50%, double vision offset 15, oil painting 3/30, skew
+ * 40 degrees), so a chain reproduces the GUI result for the same choices.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef FILTERCHAIN_H
+#define FILTERCHAIN_H
+
+#include <string>
+#include <vector>
+#include "filters/FilterTypes.h"
+#include "pipeline/FilterPipeline.h"
+
+class Image;
+
+/**
+ * @class FilterChain
+ * @brief Validated, thread-safe sequence of filters applied to every image of a batch.
+ *
+ * @example
+ * @code
+ * FilterChain chain = FilterChain::parse({"grayscale", "blur:40", "frame:shadow"});
+ * chain.apply(image); // throws std::runtime_error if a filter fails
+ * @endcode
+ */
+class FilterChain
+{
+public:
+    /**
+     * @brief Builds a chain from filter specifications of the form name[:arg[,arg...]].
+     * @param specs Filter specifications in application order
+     * @param space Working space of the filters that honor it (see ImageFilters::setWorkingSpace())
+     * @return The compiled chain
+     * @throws std::invalid_argument on an unknown filter or an invalid parameter
+     */
+    static FilterChain parse(const std::vector<std::string>& specs, WorkingSpace space = WorkingSpace::Srgb);
+
+    /**
+     * @brief Applies every filter to @p image in order.
+     *
+     * May be called concurrently from several threads on different images.
+     *
+     * @throws std::runtime_error if a filter reports a failure
+     */
+    void apply(Image& image) const;
+
+    /** @brief True if the chain has no filters (images are only re-encoded). */
+    bool empty() const { return specs.empty(); }
+
+    /** @brief The filter specifications joined with " -> ", for the run summary. */
+    std::string describe() const;
+
+    /** @brief Help text listing every filter and its parameters. */
+    static std::string usage();
+
+private:
+    std::vector<std::string> specs;  ///< Original specifications, for describe()
+    FilterPipeline pipeline;         ///< Compiled chain
+};
+
+#endif // FILTERCHAIN_H
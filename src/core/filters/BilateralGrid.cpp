@@ -0,0 +1,180 @@
+/**
+ * @file BilateralGrid.cpp
+ * @brief Implementation of the bilateral grid splat, blur and slice stages.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "BilateralGrid.h"
+#include "image/Image_Class.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+/// Empty cells around the data, so the blur kernel and trilinear reads stay inside the grid
+constexpr int Pad = 2;
+
+/// Largest grid in cells (16 bytes each)
+constexpr double MaxCells = 32.0 * 1024 * 1024;
+
+/// Nearest grid coordinate of a non-negative position
+inline int nearestCell(double position)
+{
+    return static_cast<int>(position + 0.5);
+}
+
+/**
+ * @brief Blurs @p count blocks of @p block floats, @p stride floats apart, with [1 4 6 4 1] / 16.
+ *
+ * Blocks beyond either end count as zero. @p scratch is reused between calls.
+ */
+void blurLine(float* first, int count, std::size_t stride, int block, std::vector<float>& scratch)
+{
+    const std::size_t b = static_cast<std::size_t>(block);
+    scratch.assign((static_cast<std::size_t>(count) + 4) * b, 0.0f);
+    for (int i = 0; i < count; ++i) {
+        std::copy_n(first + i * stride, b, scratch.begin() + (i + 2) * b);
+    }
+    for (int i = 0; i < count; ++i) {
+        const float* t = scratch.data() + i * b;
+        float* out = first + i * stride;
+        for (std::size_t j = 0; j < b; ++j) {
+            out[j] = (t[j] + t[j + 4 * b] + 4.0f * (t[j + b] + t[j + 3 * b]) + 6.0f * t[j + 2 * b]) * (1.0f / 16.0f);
+        }
+    }
+}
+
+} // namespace
+
+BilateralGrid::BilateralGrid(int width, int height, double sigmaSpatial, double sigmaRange)
+    : width(width), height(height)
+{
+    if (width < 1 || height < 1) {
+        throw std::invalid_argument("Image dimensions must be at least 1x1");
+    }
+    if (!(sigmaSpatial >= 1.0) || !(sigmaRange >= 1.0)) {
+        throw std::invalid_argument("Bilateral sigmas must be at least 1");
+    }
+    spatialScale = 1.0 / sigmaSpatial;
+    rangeScale = 1.0 / (3.0 * sigmaRange);
+
+    // Room for the nearest cell of every pixel, the cell after it and the padding
+    const auto extent = [](double maxPosition) { return static_cast<int>(maxPosition) + 2 + 2 * Pad; };
+    gridWidth = extent((width - 1) * spatialScale);
+    gridHeight = extent((height - 1) * spatialScale);
+    gridDepth = extent(765 * rangeScale);
+    if (static_cast<double>(gridWidth) * gridHeight * gridDepth > MaxCells) {
+        throw std::invalid_argument("Bilateral grid too large; increase the spatial or range sigma");
+    }
+    cells.assign(static_cast<std::size_t>(gridWidth) * gridHeight * gridDepth * 4, 0.0f);
+}
+
+void BilateralGrid::splatRows(const Image& src, int rowBegin, int rowEnd)
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(gridHeight, rowEnd);
+    for (int gy = rowBegin; gy < rowEnd; ++gy) {
+        // Image rows whose nearest grid row is gy, found from a slightly wider candidate range
+        const int k = gy - Pad;
+        const int yFirst = std::max(0, static_cast<int>(std::floor((k - 0.5) / spatialScale)) - 1);
+        const int yLast = std::min(height - 1, static_cast<int>(std::ceil((k + 0.5) / spatialScale)) + 1);
+        for (int y = yFirst; y <= yLast; ++y) {
+            if (nearestCell(y * spatialScale) != k) continue;
+            const unsigned char* row = src.imageData + static_cast<std::size_t>(y) * width * 3;
+            for (int x = 0; x < width; ++x) {
+                const unsigned char* p = row + x * 3;
+                const int gx = nearestCell(x * spatialScale) + Pad;
+                const int gz = nearestCell((p[0] + p[1] + p[2]) * rangeScale) + Pad;
+                float* c = cells.data() + cell(gx, gy, gz);
+                c[0] += p[0];
+                c[1] += p[1];
+                c[2] += p[2];
+                c[3] += 1.0f;
+            }
+        }
+    }
+}
+
+int BilateralGrid::slabs(int axis) const
+{
+    return axis == 1 ? gridWidth : gridHeight;
+}
+
+void BilateralGrid::blurSlabs(int axis, int slabBegin, int slabEnd)
+{
+    slabBegin = std::max(0, slabBegin);
+    slabEnd = std::min(slabs(axis), slabEnd);
+    const int depthBlock = gridDepth * 4;
+    std::vector<float> scratch;
+    for (int s = slabBegin; s < slabEnd; ++s) {
+        switch (axis) {
+        case 0:
+            // Grid row s along x, all brightness levels of a column as one block
+            blurLine(cells.data() + cell(0, s, 0), gridWidth, depthBlock, depthBlock, scratch);
+            break;
+        case 1:
+            // Grid column s along y
+            blurLine(cells.data() + cell(s, 0, 0), gridHeight, static_cast<std::size_t>(gridWidth) * depthBlock,
+                     depthBlock, scratch);
+            break;
+        default:
+            // Every brightness line of grid row s
+            for (int gx = 0; gx < gridWidth; ++gx) {
+                blurLine(cells.data() + cell(gx, s, 0), gridDepth, 4, 4, scratch);
+            }
+            break;
+        }
+    }
+}
+
+void BilateralGrid::sliceRows(const Image& src, Image& dst, int rowBegin, int rowEnd) const
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(height, rowEnd);
+    const std::size_t xStep = static_cast<std::size_t>(gridDepth) * 4;
+    const std::size_t yStep = static_cast<std::size_t>(gridWidth) * xStep;
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const double fy = y * spatialScale + Pad;
+        const int gy = static_cast<int>(fy);
+        const float wy = static_cast<float>(fy - gy);
+        const unsigned char* in = src.imageData + static_cast<std::size_t>(y) * width * 3;
+        unsigned char* out = dst.imageData + static_cast<std::size_t>(y) * width * 3;
+        for (int x = 0; x < width; ++x) {
+            const unsigned char* p = in + x * 3;
+            const double fx = x * spatialScale + Pad;
+            const double fz = (p[0] + p[1] + p[2]) * rangeScale + Pad;
+            const int gx = static_cast<int>(fx);
+            const int gz = static_cast<int>(fz);
+            const float wx = static_cast<float>(fx - gx);
+            const float wz = static_cast<float>(fz - gz);
+
+            // Trilinear interpolation of the blurred sums and count
+            float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            const float* base = cells.data() + cell(gx, gy, gz);
+            for (int corner = 0; corner < 8; ++corner) {
+                const int dx = corner & 1;
+                const int dy = (corner >> 1) & 1;
+                const int dz = corner >> 2;
+                const float w = (dx ? wx : 1.0f - wx) * (dy ? wy : 1.0f - wy) * (dz ? wz : 1.0f - wz);
+                const float* c = base + dy * yStep + dx * xStep + dz * 4;
+                for (int i = 0; i < 4; ++i) {
+                    sum[i] += w * c[i];
+                }
+            }
+            if (!(sum[3] > 0.0f)) {
+                std::copy_n(p, 3, out + x * 3);
+                continue;
+            }
+            const float scale = 1.0f / sum[3];
+            for (int i = 0; i < 3; ++i) {
+                out[x * 3 + i] = static_cast<unsigned char>(std::clamp(std::lround(sum[i] * scale), 0L, 255L));
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+/**
+ * @file BilateralGrid.h
+ * @brief Edge-preserving smoothing with the bilateral grid approximation.
+ *
+ * This file contains the declaration of the BilateralGrid used by
+ * ImageFilters::applyBilateral(). A bilateral filter averages each pixel with its
+ * neighbours weighted by both spatial distance (sigma spatial, in pixels) and brightness
+ * difference (sigma range, in 0..255 levels), so flat areas are smoothed while edges,
+ * whose sides differ by much more than the range sigma, stay sharp.
+ *
+ * @details The grid is Paris and Durand's: pixels are accumulated ("splatted") into a
+ * coarse 3D grid whose cells are one sigma apart along x, y and brightness (the mean of
+ * R, G and B), each cell holding summed RGB and a count. The grid is blurred with a
+ * separable [1 4 6 4 1] / 16 kernel, a Gaussian of one cell, and every output pixel is
+ * read back ("sliced") by trilinear interpolation at its own position and brightness,
+ * dividing the blurred color by the blurred count. The grid has about
+ * width * height / sigma_spatial^2 * 256 / sigma_range cells, so the cost is one pass
+ * over the image plus a grid pass that shrinks as the spatial sigma grows.
+ *
+ * Each stage is split into independent pieces (grid rows for the splat, slabs for the
+ * blur, image rows for the slice) so callers can run them on any number of threads.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef BILATERALGRID_H
+#define BILATERALGRID_H
+
+class Image;
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class BilateralGrid
+ * @brief Bilateral grid for images of one size.
+ *
+ * @example
+ * @code
+ * BilateralGrid grid(image.width, image.height, 8.0, 20.0);
+ * grid.splatRows(image, 0, grid.rows());
+ * for (int axis = 0; axis < BilateralGrid::Axes; ++axis) {
+ *     grid.blurSlabs(axis, 0, grid.slabs(axis));
+ * }
+ * grid.sliceRows(image, result, 0, image.height);
+ * @endcode
+ */
+class BilateralGrid
+{
+public:
+    /// Number of blur passes (x, y, brightness), run in order
+    static constexpr int Axes = 3;
+
+    /**
+     * @brief Allocates an empty grid.
+     * @param width Image width
+     * @param height Image height
+     * @param sigmaSpatial Spatial standard deviation in pixels, at least 1
+     * @param sigmaRange Brightness standard deviation in 0..255 levels, at least 1
+     * @throws std::invalid_argument if a sigma is out of range or the grid would exceed
+     *         512 MB
+     */
+    BilateralGrid(int width, int height, double sigmaSpatial, double sigmaRange);
+
+    /** @brief Number of grid rows, the unit of work of splatRows(). */
+    int rows() const { return gridHeight; }
+
+    /**
+     * @brief Accumulates the pixels of @p src falling into grid rows [rowBegin, rowEnd).
+     *
+     * Different grid rows touch disjoint cells, so ranges may run concurrently.
+     */
+    void splatRows(const Image& src, int rowBegin, int rowEnd);
+
+    /** @brief Number of independent slabs of blur pass @p axis. */
+    int slabs(int axis) const;
+
+    /**
+     * @brief Runs blur pass @p axis over slabs [slabBegin, slabEnd).
+     *
+     * Every pass must finish on all slabs before the next one starts.
+     */
+    void blurSlabs(int axis, int slabBegin, int slabEnd);
+
+    /**
+     * @brief Writes the filtered rows [rowBegin, rowEnd) of @p src into @p dst.
+     * @param src Image that was splatted
+     * @param dst Destination of the same size; may be @p src itself, since each pixel
+     *        reads only its own source value
+     */
+    void sliceRows(const Image& src, Image& dst, int rowBegin, int rowEnd) const;
+
+private:
+    std::size_t cell(int gx, int gy, int gz) const
+    {
+        return ((static_cast<std::size_t>(gy) * gridWidth + gx) * gridDepth + gz) * 4;
+    }
+
+    int width;
+    int height;
+    double spatialScale;    ///< Grid cells per pixel
+    double rangeScale;      ///< Grid cells per unit of R + G + B
+    int gridWidth;
+    int gridHeight;
+    int gridDepth;
+    std::vector<float> cells;  ///< Summed R, G, B and count per cell
+};
+
+#endif // BILATERALGRID_H
@@ -0,0 +1,193 @@
+/**
+ * @file BoxBlur.cpp
+ * @brief Implementation of the separable running-sum box blur.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "BoxBlur.h"
+#include "LinearLight.h"
+#include "image/Image_Class.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+/// round(x / 255) for x in [0, 65535] without a division
+inline int div255(int x)
+{
+    const int t = x + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+/// @p amount percent as a Q12 factor
+inline int amountFactor(int amount)
+{
+    return (std::max(0, amount) * 4096 + 50) / 100;
+}
+
+/// value + round(delta * factor / 4096), clamped to a byte
+inline unsigned char addScaled(int value, int delta, int factor)
+{
+    return static_cast<unsigned char>(std::clamp(value + ((delta * factor + 2048) >> 12), 0, 255));
+}
+
+} // namespace
+
+void BoxBlur::sumRows(const Image& src, int radius, int rowBegin, int rowEnd, const RowSink& sink, WorkingSpace space)
+{
+    const int width = src.width;
+    const int height = src.height;
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(height, rowEnd);
+    if (width <= 0 || rowEnd <= rowBegin) return;
+    radius = std::max(0, radius);
+
+    const std::size_t stride = static_cast<std::size_t>(width) * 3;
+
+    std::vector<int> countX(width);
+    for (int x = 0; x < width; ++x) {
+        countX[x] = std::min(x + radius, width - 1) - std::max(x - radius, 0) + 1;
+    }
+
+    // Horizontal window sums for the band plus its vertical halo
+    const int haloBegin = std::max(0, rowBegin - radius);
+    const int haloEnd = std::min(height, rowEnd + radius);
+    std::vector<std::uint32_t> rowSums((haloEnd - haloBegin) * stride);
+    const auto sumRow = [&](const auto* in, std::uint32_t* out) {
+        std::uint32_t s[3] = {0, 0, 0};
+        const int first = std::min(radius, width - 1);
+        for (int j = 0; j <= first; ++j) {
+            s[0] += in[j * 3 + 0];
+            s[1] += in[j * 3 + 1];
+            s[2] += in[j * 3 + 2];
+        }
+        for (int x = 0; x < width; ++x) {
+            out[x * 3 + 0] = s[0];
+            out[x * 3 + 1] = s[1];
+            out[x * 3 + 2] = s[2];
+            const int add = x + radius + 1;
+            const int sub = x - radius;
+            if (add < width) {
+                s[0] += in[add * 3 + 0];
+                s[1] += in[add * 3 + 1];
+                s[2] += in[add * 3 + 2];
+            }
+            if (sub >= 0) {
+                s[0] -= in[sub * 3 + 0];
+                s[1] -= in[sub * 3 + 1];
+                s[2] -= in[sub * 3 + 2];
+            }
+        }
+    };
+    const bool linear = space == WorkingSpace::Linear;
+    const std::uint16_t* decode = LinearLight::decodeTable();
+    std::vector<std::uint16_t> decoded(linear ? stride : 0);
+    for (int y = haloBegin; y < haloEnd; ++y) {
+        const unsigned char* in = src.imageData + y * stride;
+        std::uint32_t* out = rowSums.data() + (y - haloBegin) * stride;
+        if (linear) {
+            for (std::size_t i = 0; i < stride; ++i) decoded[i] = decode[in[i]];
+            sumRow(decoded.data(), out);
+        } else {
+            sumRow(in, out);
+        }
+    }
+
+    // Vertical running sum over the horizontal sums
+    std::vector<std::uint32_t> column(stride, 0);
+    const int firstRow = std::max(0, rowBegin - radius);
+    const int lastRow = std::min(height - 1, rowBegin + radius);
+    for (int y = firstRow; y <= lastRow; ++y) {
+        const std::uint32_t* row = rowSums.data() + (y - haloBegin) * stride;
+        for (std::size_t i = 0; i < stride; ++i) column[i] += row[i];
+    }
+
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const int countY = std::min(y + radius, height - 1) - std::max(y - radius, 0) + 1;
+        sink(y, column.data(), countX.data(), countY);
+
+        if (y + 1 >= rowEnd) break;
+        const int add = y + radius + 1;
+        const int sub = y - radius;
+        if (add < height) {
+            const std::uint32_t* row = rowSums.data() + (add - haloBegin) * stride;
+            for (std::size_t i = 0; i < stride; ++i) column[i] += row[i];
+        }
+        if (sub >= 0) {
+            const std::uint32_t* row = rowSums.data() + (sub - haloBegin) * stride;
+            for (std::size_t i = 0; i < stride; ++i) column[i] -= row[i];
+        }
+    }
+}
+
+void BoxBlur::blurRows(const Image& src, Image& dst, int radius, int rowBegin, int rowEnd, WorkingSpace space)
+{
+    const std::size_t stride = static_cast<std::size_t>(src.width) * 3;
+    if (space == WorkingSpace::Linear) {
+        const unsigned char* encode = LinearLight::encodeTable();
+        sumRows(src, radius, rowBegin, rowEnd, [&](int y, const std::uint32_t* sums, const int* countX, int countY) {
+            unsigned char* out = dst.imageData + y * stride;
+            for (int x = 0; x < src.width; ++x) {
+                const std::uint32_t count = static_cast<std::uint32_t>(countX[x] * countY);
+                out[x * 3 + 0] = encode[(sums[x * 3 + 0] + count / 2) / count];
+                out[x * 3 + 1] = encode[(sums[x * 3 + 1] + count / 2) / count];
+                out[x * 3 + 2] = encode[(sums[x * 3 + 2] + count / 2) / count];
+            }
+        }, space);
+        return;
+    }
+    sumRows(src, radius, rowBegin, rowEnd, [&](int y, const std::uint32_t* sums, const int* countX, int countY) {
+        unsigned char* out = dst.imageData + y * stride;
+        for (int x = 0; x < src.width; ++x) {
+            const std::uint32_t count = static_cast<std::uint32_t>(countX[x] * countY);
+            out[x * 3 + 0] = static_cast<unsigned char>(sums[x * 3 + 0] / count);
+            out[x * 3 + 1] = static_cast<unsigned char>(sums[x * 3 + 1] / count);
+            out[x * 3 + 2] = static_cast<unsigned char>(sums[x * 3 + 2] / count);
+        }
+    });
+}
+
+void BoxBlur::unsharpRows(const Image& src, Image& dst, int radius, int amount, int threshold,
+                          int rowBegin, int rowEnd)
+{
+    const std::size_t stride = static_cast<std::size_t>(src.width) * 3;
+    const int factor = amountFactor(amount);
+    sumRows(src, radius, rowBegin, rowEnd, [&](int y, const std::uint32_t* sums, const int* countX, int countY) {
+        const unsigned char* in = src.imageData + y * stride;
+        unsigned char* out = dst.imageData + y * stride;
+        for (int x = 0; x < src.width; ++x) {
+            const std::uint32_t count = static_cast<std::uint32_t>(countX[x] * countY);
+            for (int c = 0; c < 3; ++c) {
+                const int value = in[x * 3 + c];
+                const int delta = value - static_cast<int>(sums[x * 3 + c] / count);
+                out[x * 3 + c] = (delta > threshold || -delta > threshold) ? addScaled(value, delta, factor)
+                                                                           : static_cast<unsigned char>(value);
+            }
+        }
+    });
+}
+
+void BoxBlur::highPassRows(const Image& src, Image& dst, int radius, int amount, int rowBegin, int rowEnd)
+{
+    const std::size_t stride = static_cast<std::size_t>(src.width) * 3;
+    const int factor = amountFactor(amount);
+    sumRows(src, radius, rowBegin, rowEnd, [&](int y, const std::uint32_t* sums, const int* countX, int countY) {
+        const unsigned char* in = src.imageData + y * stride;
+        unsigned char* out = dst.imageData + y * stride;
+        for (int x = 0; x < src.width; ++x) {
+            const std::uint32_t count = static_cast<std::uint32_t>(countX[x] * countY);
+            for (int c = 0; c < 3; ++c) {
+                const int a = in[x * 3 + c];
+                const int b = std::clamp(128 + a - static_cast<int>(sums[x * 3 + c] / count), 0, 255);
+                const int overlay = a < 128 ? div255(2 * a * b) : 255 - div255(2 * (255 - a) * (255 - b));
+                out[x * 3 + c] = addScaled(a, overlay - a, factor);
+            }
+        }
+    });
+}
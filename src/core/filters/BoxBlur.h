@@ -0,0 +1,100 @@
+/**
+ * @file BoxBlur.h
+ * @brief Constant-time (per pixel) box blur built on separable running sums.
+ *
+ * This file contains the declaration of the BoxBlur helper used by the Blur filter.
+ * The cost per pixel does not depend on the radius: each row is summed horizontally
+ * with a sliding window, and the row sums are accumulated vertically with a second
+ * sliding window. Windows are clipped at the image border and divided by the number
+ * of pixels actually inside the image, exactly like the original nested-loop blur.
+ *
+ * @details Work is expressed per row band, so callers can run bands on different
+ * threads; each band recomputes the radius rows of horizontal sums it needs above
+ * and below it (its halo) instead of sharing a frame-sized intermediate. The
+ * sharpening filters consume the sums of each row directly, so they cost one pass and
+ * one output image, like the blur itself. In WorkingSpace::Linear each row is decoded to
+ * linear light as it is summed, and the blur encodes the averages back to sRGB.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef BOXBLUR_H
+#define BOXBLUR_H
+
+class Image;
+#include "FilterTypes.h"
+#include <cstdint>
+#include <functional>
+
+/**
+ * @class BoxBlur
+ * @brief Static helpers computing clipped box-window sums and averages by row band.
+ */
+class BoxBlur
+{
+public:
+    /**
+     * @brief Receives the window sums of one output row.
+     * @param y Output row index
+     * @param sums Interleaved RGB window sums (width * 3 values)
+     * @param countX Number of in-image columns in the window of each x
+     * @param countY Number of in-image rows in the window of row y
+     */
+    using RowSink = std::function<void(int y, const std::uint32_t* sums, const int* countX, int countY)>;
+
+    /**
+     * @brief Computes window sums for rows [rowBegin, rowEnd) and hands each row to @p sink.
+     * @param src Source image
+     * @param radius Window radius (window is 2 * radius + 1 pixels wide and high)
+     * @param rowBegin First output row
+     * @param rowEnd One past the last output row
+     * @param sink Callback receiving the sums of each row, in increasing y order
+     * @param space Linear sums 12-bit linear light values (see LinearLight) instead of bytes
+     */
+    static void sumRows(const Image& src, int radius, int rowBegin, int rowEnd, const RowSink& sink,
+                        WorkingSpace space = WorkingSpace::Srgb);
+
+    /**
+     * @brief Writes the box average of rows [rowBegin, rowEnd) of @p src into @p dst.
+     * @param src Source image
+     * @param dst Destination image of the same size (must not alias @p src)
+     * @param radius Window radius
+     * @param rowBegin First output row
+     * @param rowEnd One past the last output row
+     * @param space Space in which pixels are averaged
+     */
+    static void blurRows(const Image& src, Image& dst, int radius, int rowBegin, int rowEnd,
+                         WorkingSpace space = WorkingSpace::Srgb);
+
+    /**
+     * @brief Writes the unsharp mask of rows [rowBegin, rowEnd) of @p src into @p dst.
+     *
+     * Each channel becomes original + amount * (original - box average), computed
+     * directly from the window sums, so the blurred image is never stored.
+     * @param src Source image
+     * @param dst Destination image of the same size (must not alias @p src)
+     * @param radius Window radius
+     * @param amount Strength in percent (100 adds the full difference once)
+     * @param threshold Channels whose difference from the average is at most this are kept
+     * @param rowBegin First output row
+     * @param rowEnd One past the last output row
+     */
+    static void unsharpRows(const Image& src, Image& dst, int radius, int amount, int threshold,
+                            int rowBegin, int rowEnd);
+
+    /**
+     * @brief Writes the high-pass sharpening of rows [rowBegin, rowEnd) of @p src into @p dst.
+     *
+     * The high-pass layer 128 + (original - box average) is overlay-blended onto the
+     * original and mixed in by @p amount, as in the usual High Pass + Overlay workflow;
+     * like unsharpRows() it works from the window sums without a blurred copy.
+     * @param amount Strength in percent (100 applies the overlay fully)
+     */
+    static void highPassRows(const Image& src, Image& dst, int radius, int amount, int rowBegin, int rowEnd);
+};
+
+#endif // BOXBLUR_H
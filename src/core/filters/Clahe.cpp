@@ -0,0 +1,178 @@
+/**
+ * @file Clahe.cpp
+ * @brief Implementation of the tile tone curves and their bilinear blend.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "Clahe.h"
+#include "image/Image_Class.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/// First pixel of tile @p index of @p tiles along an axis of @p size pixels
+inline int tileStart(int index, int size, int tiles)
+{
+    return static_cast<int>(static_cast<long long>(index) * size / tiles);
+}
+
+/// Pixel position of the center of a tile
+inline double tileCenter(int index, int size, int tiles)
+{
+    return (tileStart(index, size, tiles) + tileStart(index + 1, size, tiles) - 1) / 2.0;
+}
+
+/**
+ * @brief Blend of position @p p between the two tile centers around it.
+ * @param tile Receives the first tile; the second is the next one (or the same at the ends)
+ * @return Weight of the second tile in [0, 256]
+ */
+int blendWeight(int p, int size, int tiles, int& tile)
+{
+    if (p <= tileCenter(0, size, tiles)) {
+        tile = 0;
+        return 0;
+    }
+    if (p >= tileCenter(tiles - 1, size, tiles)) {
+        tile = tiles - 1;
+        return 0;
+    }
+    tile = 0;
+    while (tileCenter(tile + 1, size, tiles) <= p) ++tile;
+    const double c0 = tileCenter(tile, size, tiles);
+    const double c1 = tileCenter(tile + 1, size, tiles);
+    return static_cast<int>(std::lround((p - c0) / (c1 - c0) * 256.0));
+}
+
+} // namespace
+
+Clahe::Clahe(int width, int height, int tilesX, int tilesY, double clipLimit)
+    : width(width), height(height), tilesX(tilesX), tilesY(tilesY), clipLimit(clipLimit)
+{
+    if (tilesX < 1 || tilesY < 1 || tilesX > MaxTiles || tilesY > MaxTiles) {
+        throw std::invalid_argument("CLAHE needs between 1 and " + std::to_string(MaxTiles) + " tiles per side");
+    }
+    if (tilesX > width || tilesY > height) {
+        throw std::invalid_argument("CLAHE tiles must be at least one pixel");
+    }
+    if (!(clipLimit >= 0.0)) {
+        throw std::invalid_argument("CLAHE clip limit must not be negative");
+    }
+    columnTile.resize(width);
+    columnWeight.resize(width);
+    for (int x = 0; x < width; ++x) {
+        columnWeight[x] = blendWeight(x, width, tilesX, columnTile[x]);
+    }
+    curves.assign(static_cast<std::size_t>(tileCount()) * 256, 0);
+}
+
+void Clahe::buildTiles(const Image& image, int tileBegin, int tileEnd)
+{
+    tileBegin = std::max(0, tileBegin);
+    tileEnd = std::min(tileCount(), tileEnd);
+    for (int t = tileBegin; t < tileEnd; ++t) {
+        const int x0 = tileStart(t % tilesX, width, tilesX);
+        const int x1 = tileStart(t % tilesX + 1, width, tilesX);
+        const int y0 = tileStart(t / tilesX, height, tilesY);
+        const int y1 = tileStart(t / tilesX + 1, height, tilesY);
+
+        std::uint32_t bins[256] = {};
+        for (int y = y0; y < y1; ++y) {
+            const unsigned char* p = image.imageData + (static_cast<std::size_t>(y) * width + x0) * 3;
+            for (int x = x0; x < x1; ++x, p += 3) {
+                ++bins[(p[0] + p[1] + p[2]) / 3];
+            }
+        }
+        const std::uint64_t area = static_cast<std::uint64_t>(x1 - x0) * (y1 - y0);
+
+        if (clipLimit > 0.0) {
+            // Cut every bin at the limit and spread the excess: evenly, then one count per
+            // bin at a regular stride for the remainder
+            const std::uint32_t limit = static_cast<std::uint32_t>(
+                std::max(1.0, clipLimit * static_cast<double>(area) / 256.0));
+            std::uint64_t excess = 0;
+            for (std::uint32_t& bin : bins) {
+                if (bin > limit) {
+                    excess += bin - limit;
+                    bin = limit;
+                }
+            }
+            const std::uint32_t share = static_cast<std::uint32_t>(excess / 256);
+            int remainder = static_cast<int>(excess % 256);
+            for (std::uint32_t& bin : bins) bin += share;
+            if (remainder > 0) {
+                const int stride = std::max(1, 256 / remainder);
+                for (int v = 0; v < 256 && remainder > 0; v += stride, --remainder) ++bins[v];
+            }
+        }
+
+        unsigned char* curve = curves.data() + static_cast<std::size_t>(t) * 256;
+        std::uint64_t cumulative = 0;
+        for (int v = 0; v < 256; ++v) {
+            cumulative += bins[v];
+            curve[v] = static_cast<unsigned char>(std::min<std::uint64_t>(255, (cumulative * 255 + area / 2) / area));
+        }
+    }
+}
+
+void Clahe::applyRows(Image& image, int rowBegin, int rowEnd) const
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(height, rowEnd);
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        int tileY = 0;
+        const int wy = blendWeight(y, height, tilesY, tileY);
+        const int nextY = std::min(tileY + 1, tilesY - 1);
+        const unsigned char* top = curves.data() + static_cast<std::size_t>(tileY) * tilesX * 256;
+        const unsigned char* bottom = curves.data() + static_cast<std::size_t>(nextY) * tilesX * 256;
+
+        unsigned char* p = image.imageData + static_cast<std::size_t>(y) * width * 3;
+        for (int x = 0; x < width; ++x, p += 3) {
+            const int tileX = columnTile[x];
+            const int wx = columnWeight[x];
+            const std::size_t left = static_cast<std::size_t>(tileX) * 256;
+            const std::size_t right = static_cast<std::size_t>(std::min(tileX + 1, tilesX - 1)) * 256;
+            for (int c = 0; c < 3; ++c) {
+                const int v = p[c];
+                const int upper = top[left + v] * (256 - wx) + top[right + v] * wx;
+                const int lower = bottom[left + v] * (256 - wx) + bottom[right + v] * wx;
+                p[c] = static_cast<unsigned char>((upper * (256 - wy) + lower * wy + 32768) >> 16);
+            }
+        }
+    }
+}
+
+void Clahe::equalizationTable(const Histogram::Bins& counts, unsigned char table[256])
+{
+    std::uint64_t total = 0;
+    for (std::uint64_t count : counts) total += count;
+    // Cumulative count of the darkest level in use
+    std::uint64_t darkest = 0;
+    for (std::uint64_t count : counts) {
+        if (count) {
+            darkest = count;
+            break;
+        }
+    }
+    if (total == darkest) {
+        for (int v = 0; v < 256; ++v) table[v] = static_cast<unsigned char>(v);
+        return;
+    }
+    const std::uint64_t range = total - darkest;
+    std::uint64_t cumulative = 0;
+    for (int v = 0; v < 256; ++v) {
+        cumulative += counts[v];
+        const std::uint64_t above = cumulative > darkest ? cumulative - darkest : 0;
+        table[v] = static_cast<unsigned char>((above * 255 + range / 2) / range);
+    }
+}
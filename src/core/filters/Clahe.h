@@ -0,0 +1,96 @@
+/**
+ * @file Clahe.h
+ * @brief Histogram equalization and contrast-limited adaptive histogram equalization.
+ *
+ * This file contains the declaration of the Clahe class used by
+ * ImageFilters::applyEqualize() and ImageFilters::applyClahe(). Both spread the gray
+ * levels of an image so that they are used evenly, which rescues flat or unevenly
+ * exposed scans. Global equalization uses one tone curve for the whole image; CLAHE
+ * computes one curve per tile of a grid, limits how steep each curve may get (so noise
+ * in flat areas is not amplified), and blends the curves of the four nearest tiles
+ * bilinearly so no tile seams show.
+ *
+ * @details The curves are built from the gray-level histogram ((R + G + B) / 3) and
+ * applied to every channel, like a Curves adjustment, so grays stay gray and colors
+ * keep their hue family. Clipping follows the usual CLAHE rule: bins above
+ * clipLimit * tilePixels / 256 are cut and the excess is spread evenly over all bins.
+ * Tile curves are independent, so they are built in parallel; the blend is applied by
+ * row band with 8-bit fixed-point weights.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef CLAHE_H
+#define CLAHE_H
+
+class Image;
+#include "image/Histogram.h"
+#include <vector>
+
+/**
+ * @class Clahe
+ * @brief Tile tone curves of one image and their bilinear application.
+ *
+ * @example
+ * @code
+ * Clahe clahe(image.width, image.height, 8, 8, 2.0);
+ * clahe.buildTiles(image, 0, clahe.tileCount());
+ * clahe.applyRows(image, 0, image.height);
+ * @endcode
+ */
+class Clahe
+{
+public:
+    /// Largest number of tiles along either axis
+    static constexpr int MaxTiles = 64;
+
+    /**
+     * @brief Lays out a @p tilesX x @p tilesY grid over a @p width x @p height image.
+     * @param clipLimit Largest bin height as a multiple of the mean bin height, or 0 for
+     *        no limit (plain adaptive equalization)
+     * @throws std::invalid_argument if the grid is empty, finer than the image or larger
+     *         than MaxTiles, or the clip limit is negative
+     */
+    Clahe(int width, int height, int tilesX, int tilesY, double clipLimit);
+
+    /** @brief Number of tiles, the unit of work of buildTiles(). */
+    int tileCount() const { return tilesX * tilesY; }
+
+    /**
+     * @brief Builds the tone curves of tiles [tileBegin, tileEnd) from @p image.
+     *
+     * Tiles are numbered row by row; ranges may run concurrently.
+     */
+    void buildTiles(const Image& image, int tileBegin, int tileEnd);
+
+    /**
+     * @brief Applies the blended tone curves in place to rows [rowBegin, rowEnd).
+     *
+     * Requires every tile to be built; bands may run concurrently.
+     */
+    void applyRows(Image& image, int rowBegin, int rowEnd) const;
+
+    /**
+     * @brief Global histogram equalization curve of @p counts.
+     *
+     * Maps the darkest used level to 0 and spreads the others by cumulative count up to
+     * 255; a histogram with a single level maps to the identity.
+     */
+    static void equalizationTable(const Histogram::Bins& counts, unsigned char table[256]);
+
+private:
+    int width;
+    int height;
+    int tilesX;
+    int tilesY;
+    double clipLimit;
+    std::vector<int> columnTile;      ///< Left tile of the blend for each column
+    std::vector<int> columnWeight;    ///< Weight of the right tile in [0, 256]
+    std::vector<unsigned char> curves; ///< 256 entries per tile, row by row
+};
+
+#endif // CLAHE_H
@@ -0,0 +1,277 @@
+/**
+ * @file Compositor.cpp
+ * @brief Implementation of the fixed-point blend kernels and overlay placement.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "Compositor.h"
+#include "LinearLight.h"
+#include "image/Image_Class.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/// round(x / 255) for x in [0, 65535] without a division
+inline int div255(int x)
+{
+    const int t = x + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+#if defined(__AVX2__)
+inline __m256i div255(__m256i x)
+{
+    const __m256i t = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+#endif
+
+/// round(x / LinearLight::Max) for x >= 0
+inline int divLinear(int x)
+{
+    return (x + LinearLight::Max / 2) / LinearLight::Max;
+}
+
+// Blend formulas on 8-bit values held in 16-bit lanes; every intermediate stays below 65536.
+// Each has a scalar form and, when available, an AVX2 form with identical results, plus
+// a linear form on 12-bit linear light for WorkingSpace::Linear.
+
+struct NormalBlend {
+    static int apply(int, int b) { return b; }
+    static int linear(int, int b) { return b; }
+#if defined(__AVX2__)
+    static __m256i apply(__m256i, __m256i b) { return b; }
+#endif
+};
+
+struct MultiplyBlend {
+    static int apply(int a, int b) { return div255(a * b); }
+    static int linear(int a, int b) { return divLinear(a * b); }
+#if defined(__AVX2__)
+    static __m256i apply(__m256i a, __m256i b) { return div255(_mm256_mullo_epi16(a, b)); }
+#endif
+};
+
+struct ScreenBlend {
+    static int apply(int a, int b) { return 255 - div255((255 - a) * (255 - b)); }
+    static int linear(int a, int b) { return LinearLight::Max - divLinear((LinearLight::Max - a) * (LinearLight::Max - b)); }
+#if defined(__AVX2__)
+    static __m256i apply(__m256i a, __m256i b)
+    {
+        const __m256i white = _mm256_set1_epi16(255);
+        const __m256i product = _mm256_mullo_epi16(_mm256_sub_epi16(white, a), _mm256_sub_epi16(white, b));
+        return _mm256_sub_epi16(white, div255(product));
+    }
+#endif
+};
+
+struct OverlayBlend {
+    static int apply(int a, int b)
+    {
+        return a < 128 ? div255(2 * a * b) : 255 - div255(2 * (255 - a) * (255 - b));
+    }
+    static int linear(int a, int b)
+    {
+        constexpr int white = LinearLight::Max;
+        return 2 * a <= white ? divLinear(2 * a * b) : white - divLinear(2 * (white - a) * (white - b));
+    }
+#if defined(__AVX2__)
+    static __m256i apply(__m256i a, __m256i b)
+    {
+        const __m256i white = _mm256_set1_epi16(255);
+        const __m256i dark = div255(_mm256_slli_epi16(_mm256_mullo_epi16(a, b), 1));
+        const __m256i inverse = _mm256_mullo_epi16(_mm256_sub_epi16(white, a), _mm256_sub_epi16(white, b));
+        const __m256i light = _mm256_sub_epi16(white, div255(_mm256_slli_epi16(inverse, 1)));
+        const __m256i isLight = _mm256_cmpgt_epi16(a, _mm256_set1_epi16(127));
+        return _mm256_blendv_epi8(dark, light, isLight);
+    }
+#endif
+};
+
+struct AddBlend {
+    static int apply(int a, int b) { return std::min(255, a + b); }
+    static int linear(int a, int b) { return std::min(LinearLight::Max, a + b); }
+#if defined(__AVX2__)
+    static __m256i apply(__m256i a, __m256i b) { return _mm256_min_epu16(_mm256_add_epi16(a, b), _mm256_set1_epi16(255)); }
+#endif
+};
+
+struct DifferenceBlend {
+    static int apply(int a, int b) { return a > b ? a - b : b - a; }
+    static int linear(int a, int b) { return a > b ? a - b : b - a; }
+#if defined(__AVX2__)
+    static __m256i apply(__m256i a, __m256i b) { return _mm256_abs_epi16(_mm256_sub_epi16(a, b)); }
+#endif
+};
+
+#if defined(__AVX2__)
+/// (a * (256 - w) + f * w + 127) >> 8 on 16 lanes
+inline __m256i mix(__m256i a, __m256i f, __m256i w)
+{
+    const __m256i sum = _mm256_add_epi16(_mm256_mullo_epi16(a, _mm256_sub_epi16(_mm256_set1_epi16(256), w)),
+                                         _mm256_mullo_epi16(f, w));
+    return _mm256_srli_epi16(_mm256_add_epi16(sum, _mm256_set1_epi16(127)), 8);
+}
+#endif
+
+/**
+ * @brief Blends @p count bytes of @p b into @p a.
+ * @param weights Per-byte weights in [0, 256], or null to use @p weight for every byte
+ */
+template <class Blend>
+void blendSpan(unsigned char* a, const unsigned char* b, const std::uint16_t* weights, int weight, std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i constantWeight = _mm256_set1_epi16(static_cast<short>(weight));
+    for (; i + 32 <= count; i += 32) {
+        const __m256i base = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i top = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i a0 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(base));
+        const __m256i a1 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(base, 1));
+        const __m256i b0 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(top));
+        const __m256i b1 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(top, 1));
+        __m256i w0 = constantWeight;
+        __m256i w1 = constantWeight;
+        if (weights) {
+            w0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i));
+            w1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i + 16));
+        }
+        const __m256i r0 = mix(a0, Blend::apply(a0, b0), w0);
+        const __m256i r1 = mix(a1, Blend::apply(a1, b1), w1);
+        // packus interleaves the 128-bit lanes; restore byte order
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(r0, r1), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), packed);
+    }
+#endif
+    for (; i < count; ++i) {
+        const int w = weights ? weights[i] : weight;
+        const int f = Blend::apply(a[i], b[i]);
+        a[i] = static_cast<unsigned char>((a[i] * (256 - w) + f * w + 127) >> 8);
+    }
+}
+
+void blendSpan(BlendMode mode, unsigned char* a, const unsigned char* b, const std::uint16_t* weights, int weight,
+               std::size_t count)
+{
+    switch (mode) {
+    case BlendMode::Normal: blendSpan<NormalBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Multiply: blendSpan<MultiplyBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Screen: blendSpan<ScreenBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Overlay: blendSpan<OverlayBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Add: blendSpan<AddBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Difference: blendSpan<DifferenceBlend>(a, b, weights, weight, count); break;
+    }
+}
+
+/**
+ * @brief Blends @p count bytes of @p b into @p a in linear light, decoding and encoding
+ *        each byte on the fly.
+ */
+template <class Blend>
+void blendLinearSpan(unsigned char* a, const unsigned char* b, const std::uint16_t* weights, int weight,
+                     std::size_t count)
+{
+    const std::uint16_t* decode = LinearLight::decodeTable();
+    const unsigned char* encode = LinearLight::encodeTable();
+    for (std::size_t i = 0; i < count; ++i) {
+        const int w = weights ? weights[i] : weight;
+        const int base = decode[a[i]];
+        const int f = Blend::linear(base, decode[b[i]]);
+        a[i] = encode[(base * (256 - w) + f * w + 128) >> 8];
+    }
+}
+
+void blendLinearSpan(BlendMode mode, unsigned char* a, const unsigned char* b, const std::uint16_t* weights,
+                     int weight, std::size_t count)
+{
+    switch (mode) {
+    case BlendMode::Normal: blendLinearSpan<NormalBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Multiply: blendLinearSpan<MultiplyBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Screen: blendLinearSpan<ScreenBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Overlay: blendLinearSpan<OverlayBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Add: blendLinearSpan<AddBlend>(a, b, weights, weight, count); break;
+    case BlendMode::Difference: blendLinearSpan<DifferenceBlend>(a, b, weights, weight, count); break;
+    }
+}
+
+/// Offset of an aligned edge: 0 for start, 1 for center, 2 for end
+long long alignedOffset(int baseSize, int overlaySize, int position)
+{
+    const long long slack = static_cast<long long>(baseSize) - overlaySize;
+    return position == 0 ? 0 : position == 1 ? slack / 2 : slack;
+}
+
+} // namespace
+
+Compositor::Compositor(int baseWidth, int baseHeight, const Image& overlay, const CompositeOptions& options,
+                       WorkingSpace space)
+    : mode(options.mode), space(space), mask(options.mask)
+{
+    if (!(options.opacity >= 0.0 && options.opacity <= 1.0)) {
+        throw std::invalid_argument("Opacity must be between 0 and 1");
+    }
+    if (mask && (mask->width != overlay.width || mask->height != overlay.height)) {
+        throw std::invalid_argument("Mask size must match the overlay size");
+    }
+    weight = static_cast<int>(std::lround(options.opacity * 256.0));
+
+    const int anchor = static_cast<int>(options.anchor);
+    const long long left = alignedOffset(baseWidth, overlay.width, anchor % 3) + options.offsetX;
+    const long long top = alignedOffset(baseHeight, overlay.height, anchor / 3) + options.offsetY;
+    const auto clampToBase = [](long long v, int size) { return static_cast<int>(std::clamp<long long>(v, 0, size)); };
+    x0 = clampToBase(left, baseWidth);
+    x1 = clampToBase(left + overlay.width, baseWidth);
+    y0 = clampToBase(top, baseHeight);
+    y1 = clampToBase(top + overlay.height, baseHeight);
+    overlayLeft = static_cast<int>(std::clamp<long long>(left, -overlay.width, baseWidth));
+    overlayTop = static_cast<int>(std::clamp<long long>(top, -overlay.height, baseHeight));
+}
+
+void Compositor::compositeRows(Image& base, const Image& overlay, int rowBegin, int rowEnd) const
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(height(), rowEnd);
+    if (rowEnd <= rowBegin || width() <= 0 || weight == 0) return;
+
+    const std::size_t count = static_cast<std::size_t>(width()) * 3;
+    const std::size_t baseStride = static_cast<std::size_t>(base.width) * 3;
+    const std::size_t overlayStride = static_cast<std::size_t>(overlay.width) * 3;
+    const std::size_t baseX = static_cast<std::size_t>(x0) * 3;
+    const std::size_t overlayX = static_cast<std::size_t>(x0 - overlayLeft) * 3;
+
+    std::vector<std::uint16_t> weights(mask ? count : 0);
+    for (int r = rowBegin; r < rowEnd; ++r) {
+        const int y = y0 + r;
+        const std::size_t overlayRow = static_cast<std::size_t>(y - overlayTop) * overlayStride + overlayX;
+        if (mask) {
+            // Per-byte weight: mask alpha (channel mean) scaled by the opacity
+            const unsigned char* m = mask->imageData + overlayRow;
+            for (std::size_t i = 0; i < count; i += 3) {
+                const int alpha = (m[i] + m[i + 1] + m[i + 2]) / 3;
+                const std::uint16_t w = static_cast<std::uint16_t>(div255(alpha * weight));
+                weights[i] = weights[i + 1] = weights[i + 2] = w;
+            }
+        }
+        unsigned char* a = base.imageData + y * baseStride + baseX;
+        const unsigned char* b = overlay.imageData + overlayRow;
+        if (space == WorkingSpace::Linear) {
+            blendLinearSpan(mode, a, b, mask ? weights.data() : nullptr, weight, count);
+        } else {
+            blendSpan(mode, a, b, mask ? weights.data() : nullptr, weight, count);
+        }
+    }
+}
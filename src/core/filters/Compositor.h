@@ -0,0 +1,94 @@
+/**
+ * @file Compositor.h
+ * @brief Blend-mode compositing of an overlay image onto a base image.
+ *
+ * This file contains the declaration of CompositeOptions and of the Compositor used by
+ * ImageFilters::applyMerge() to place an overlay (a second photo, a watermark, a brand
+ * asset) on an image: anchored and offset, with a global opacity, an optional
+ * grayscale alpha mask and one of the BlendMode formulas.
+ *
+ * @details All arithmetic is 16-bit fixed point. Opacity and mask combine into a weight
+ * w in [0, 256] per pixel, the blend formula gives f(a, b) in [0, 255], and the result
+ * is (a * (256 - w) + f * w + 127) >> 8, so a 50% Normal blend is exactly (a + b) / 2.
+ * Builds with AVX2 enabled (PHOTOSMITH_NATIVE_ARCH on a capable CPU) run each mode as a
+ * 32-byte-wide kernel; other builds use a scalar loop with identical results.
+ *
+ * In WorkingSpace::Linear both images are decoded to 12-bit linear light byte by byte
+ * as they are blended and the result is encoded back, so a 50% Normal blend averages
+ * the light of the two images rather than their sRGB levels. That path is scalar.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+class Image;
+#include "FilterTypes.h"
+
+/**
+ * @brief Placement and blending of an overlay.
+ */
+struct CompositeOptions {
+    BlendMode mode = BlendMode::Normal;
+    double opacity = 1.0;               ///< Overlay weight in [0, 1]
+    Anchor anchor = Anchor::TopLeft;    ///< Alignment of the overlay on the base
+    int offsetX = 0;                    ///< Shift right from the anchored position, in pixels
+    int offsetY = 0;                    ///< Shift down from the anchored position, in pixels
+    const Image* mask = nullptr;        ///< Optional alpha of the overlay's size (channel mean, white = opaque)
+};
+
+/**
+ * @class Compositor
+ * @brief Composites one overlay onto bases of one size.
+ *
+ * Only the part of the overlay that lands on the base is blended; the base keeps its size.
+ */
+class Compositor
+{
+public:
+    /**
+     * @brief Resolves the placement of @p overlay on a @p baseWidth x @p baseHeight base.
+     * @param space Space in which the blend formula and the opacity mix are evaluated
+     * @throws std::invalid_argument if the opacity is outside [0, 1] or the mask size
+     *         differs from the overlay size
+     */
+    Compositor(int baseWidth, int baseHeight, const Image& overlay, const CompositeOptions& options,
+               WorkingSpace space = WorkingSpace::Srgb);
+
+    /** @brief First base column of the blended region. */
+    int firstColumn() const { return x0; }
+    /** @brief First base row of the blended region. */
+    int firstRow() const { return y0; }
+    /** @brief Width of the blended region. */
+    int width() const { return x1 - x0; }
+    /** @brief Height of the blended region. */
+    int height() const { return y1 - y0; }
+
+    /**
+     * @brief Blends rows [rowBegin, rowEnd) of the blended region into @p base.
+     *
+     * Rows are numbered from 0 to height(); bands may run concurrently.
+     *
+     * @param base Base image of the size given to the constructor (modified in place)
+     * @param overlay Overlay given to the constructor
+     * @param rowBegin First row of the region
+     * @param rowEnd One past the last row of the region
+     */
+    void compositeRows(Image& base, const Image& overlay, int rowBegin, int rowEnd) const;
+
+private:
+    BlendMode mode;
+    WorkingSpace space;
+    int weight;              ///< Opacity in [0, 256]
+    const Image* mask;
+    int overlayLeft;         ///< Base column of the overlay's left edge (may be negative)
+    int overlayTop;          ///< Base row of the overlay's top edge (may be negative)
+    int x0, y0, x1, y1;      ///< Blended region in base coordinates
+};
+
+#endif // COMPOSITOR_H
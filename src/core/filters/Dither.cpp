@@ -0,0 +1,195 @@
+/**
+ * @file Dither.cpp
+ * @brief Implementation of the thresholds, the Bayer dither and the wavefront error diffusion.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "Dither.h"
+#include "image/Image_Class.h"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace {
+
+/// Order in which the cells of an 8x8 block turn white as the gray level rises
+constexpr unsigned char bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+inline unsigned char* rowPixels(Image& image, int y)
+{
+    return image.imageData + static_cast<std::size_t>(y) * image.width * 3;
+}
+
+} // namespace
+
+int Dither::otsuThreshold(const Histogram::Bins& gray)
+{
+    double total = 0.0;
+    double weightedTotal = 0.0;
+    for (int v = 0; v < 256; ++v) {
+        total += static_cast<double>(gray[v]);
+        weightedTotal += static_cast<double>(v) * static_cast<double>(gray[v]);
+    }
+
+    // Between-class variance of splitting after level t, up to the constant 1 / total^2
+    int best = 127;
+    double bestVariance = 0.0;
+    double below = 0.0;
+    double weightedBelow = 0.0;
+    for (int t = 0; t < 255; ++t) {
+        below += static_cast<double>(gray[t]);
+        weightedBelow += static_cast<double>(t) * static_cast<double>(gray[t]);
+        const double above = total - below;
+        if (below == 0.0 || above == 0.0) continue;
+        const double difference = weightedBelow / below - (weightedTotal - weightedBelow) / above;
+        const double variance = below * above * difference * difference;
+        if (variance > bestVariance) {
+            bestVariance = variance;
+            best = t;
+        }
+    }
+    return best;
+}
+
+void Dither::thresholdRows(Image& image, int threshold, int rowBegin, int rowEnd)
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(image.height, rowEnd);
+    if (rowEnd <= rowBegin) return;
+    unsigned char* p = rowPixels(image, rowBegin);
+    const std::size_t count = static_cast<std::size_t>(rowEnd - rowBegin) * image.width;
+    for (std::size_t i = 0; i < count; ++i, p += 3) {
+        int gray = (p[0] + p[1] + p[2]) / 3;
+        unsigned char bw = (gray > threshold) ? 255 : 0;
+        p[0] = p[1] = p[2] = bw;
+    }
+}
+
+void Dither::bayerRows(Image& image, int rowBegin, int rowEnd)
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(image.height, rowEnd);
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        // Thresholds of this row spread over 1..253, so 0 stays black and 255 white
+        int levels[8];
+        for (int i = 0; i < 8; ++i) {
+            levels[i] = (2 * bayer8[y & 7][i] + 1) * 255 / 128;
+        }
+        unsigned char* p = rowPixels(image, y);
+        for (int x = 0; x < image.width; ++x, p += 3) {
+            int gray = (p[0] + p[1] + p[2]) / 3;
+            unsigned char bw = (gray > levels[x & 7]) ? 255 : 0;
+            p[0] = p[1] = p[2] = bw;
+        }
+    }
+}
+
+int Dither::bayerRank(int x, int y)
+{
+    return bayer8[y & 7][x & 7];
+}
+
+ErrorDiffusion::ErrorDiffusion(int width, int height)
+    : width(width), height(height)
+{
+    if (width < 1 || height < 1) {
+        throw std::invalid_argument("Error diffusion needs a non-empty image");
+    }
+    // Row i of a band starts 2i columns further left, so a band spans 2 (BandRows - 1)
+    // extra columns. The first row of a band needs the last row of the band above one
+    // column further right, which is waveStride tiles of that band ahead.
+    bands = (height + BandRows - 1) / BandRows;
+    tilesPerBand = (width + 2 * (BandRows - 1) + TileColumns - 1) / TileColumns;
+    waveStride = (2 * BandRows - 2) / TileColumns + 2;
+    gray.resize(static_cast<std::size_t>(width) * height);
+}
+
+void ErrorDiffusion::loadRows(const Image& image, int rowBegin, int rowEnd)
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(height, rowEnd);
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const unsigned char* p = image.imageData + static_cast<std::size_t>(y) * width * 3;
+        std::int16_t* out = gray.data() + static_cast<std::size_t>(y) * width;
+        for (int x = 0; x < width; ++x, p += 3) {
+            out[x] = static_cast<std::int16_t>((p[0] + p[1] + p[2]) / 3);
+        }
+    }
+}
+
+int ErrorDiffusion::waves() const
+{
+    return tilesPerBand + waveStride * (bands - 1);
+}
+
+int ErrorDiffusion::tilesInWave(int wave) const
+{
+    // Tile t of band b belongs to wave t + waveStride * b
+    const int firstBand = std::max(0, (wave - tilesPerBand + waveStride) / waveStride);
+    const int lastBand = std::min(bands - 1, wave / waveStride);
+    return std::max(0, lastBand - firstBand + 1);
+}
+
+void ErrorDiffusion::diffuseTiles(int wave, int tileBegin, int tileEnd)
+{
+    const int firstBand = std::max(0, (wave - tilesPerBand + waveStride) / waveStride);
+    tileBegin = std::max(0, tileBegin);
+    tileEnd = std::min(tilesInWave(wave), tileEnd);
+    for (int i = tileBegin; i < tileEnd; ++i) {
+        const int band = firstBand + i;
+        diffuseTile(band, wave - waveStride * band);
+    }
+}
+
+void ErrorDiffusion::diffuseTile(int band, int tile)
+{
+    const int y0 = band * BandRows;
+    const int y1 = std::min(height, y0 + BandRows);
+    for (int y = y0; y < y1; ++y) {
+        const int shift = 2 * (y - y0);
+        const int x0 = std::max(0, tile * TileColumns - shift);
+        const int x1 = std::min(width, (tile + 1) * TileColumns - shift);
+        std::int16_t* row = gray.data() + static_cast<std::size_t>(y) * width;
+        std::int16_t* below = y + 1 < height ? row + width : nullptr;
+        for (int x = x0; x < x1; ++x) {
+            const int value = row[x];
+            const int out = value > 127 ? 255 : 0;
+            const int error = value - out;
+            row[x] = static_cast<std::int16_t>(out);
+            // 7/16 right, 3/16 lower left, 5/16 below, 1/16 lower right
+            if (x + 1 < width) row[x + 1] = static_cast<std::int16_t>(row[x + 1] + error * 7 / 16);
+            if (below) {
+                if (x > 0) below[x - 1] = static_cast<std::int16_t>(below[x - 1] + error * 3 / 16);
+                below[x] = static_cast<std::int16_t>(below[x] + error * 5 / 16);
+                if (x + 1 < width) below[x + 1] = static_cast<std::int16_t>(below[x + 1] + error / 16);
+            }
+        }
+    }
+}
+
+void ErrorDiffusion::storeRows(Image& image, int rowBegin, int rowEnd) const
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(height, rowEnd);
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const std::int16_t* in = gray.data() + static_cast<std::size_t>(y) * width;
+        unsigned char* p = rowPixels(image, y);
+        for (int x = 0; x < width; ++x, p += 3) {
+            p[0] = p[1] = p[2] = static_cast<unsigned char>(in[x]);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/**
+ * @file Dither.h
+ * @brief Automatic thresholds and halftoning for the Black & White filter.
+ *
+ * This file contains the declarations of the Dither helpers and the ErrorDiffusion
+ * class used by ImageFilters::applyBlackAndWhite(). They reduce the gray level
+ * (R + G + B) / 3 of an image to pure black and white, for 1-bit printers and fax-like
+ * output: with a fixed or an Otsu threshold, with an ordered (Bayer) dither, or with
+ * Floyd-Steinberg error diffusion.
+ *
+ * @details Thresholds and the Bayer dither treat every pixel independently and run by
+ * row band. Error diffusion pushes the rounding error of each pixel to its right and
+ * lower neighbours, so pixel (x, y) can only be decided after (x - 1, y) and
+ * (x + 1, y - 1). ErrorDiffusion runs it as a wavefront: the image is cut into bands
+ * of BandRows rows and each band into tiles of TileColumns columns that lean two pixels
+ * left per row, and tiles far enough apart along the diagonal run concurrently. The
+ * result is identical to a serial left-to-right, top-to-bottom pass.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef DITHER_H
+#define DITHER_H
+
+class Image;
+#include "image/Histogram.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class Dither
+ * @brief Per-pixel black and white conversions.
+ */
+class Dither
+{
+public:
+    /**
+     * @brief Otsu threshold of a gray histogram.
+     *
+     * Picks the level that maximizes the variance between the levels at or below it and
+     * those above it, so a dark-on-light label splits cleanly between ink and paper.
+     * @return Threshold for thresholdRows(); 127 if the histogram has a single level
+     */
+    static int otsuThreshold(const Histogram::Bins& gray);
+
+    /**
+     * @brief Sets rows [rowBegin, rowEnd) to white where the gray level is above
+     *        @p threshold and to black elsewhere.
+     */
+    static void thresholdRows(Image& image, int threshold, int rowBegin, int rowEnd);
+
+    /**
+     * @brief Ordered dither of rows [rowBegin, rowEnd) with an 8x8 Bayer matrix.
+     *
+     * The pattern is anchored to the image origin, so bands may run concurrently.
+     */
+    static void bayerRows(Image& image, int rowBegin, int rowEnd);
+
+    /**
+     * @brief Rank of pixel (x, y) in the 8x8 Bayer matrix, in [0, 63].
+     *
+     * Pixels of low rank turn white first as the gray level rises; other halftoning
+     * filters use the rank as a dither offset.
+     */
+    static int bayerRank(int x, int y);
+};
+
+/**
+ * @class ErrorDiffusion
+ * @brief Floyd-Steinberg error diffusion on a wavefront of tiles.
+ *
+ * @example
+ * @code
+ * ErrorDiffusion diffusion(image.width, image.height);
+ * diffusion.loadRows(image, 0, image.height);
+ * for (int wave = 0; wave < diffusion.waves(); ++wave) {
+ *     diffusion.diffuseTiles(wave, 0, diffusion.tilesInWave(wave)); // tiles may run concurrently
+ * }
+ * diffusion.storeRows(image, 0, image.height);
+ * @endcode
+ */
+class ErrorDiffusion
+{
+public:
+    /// Rows per band of the wavefront
+    static constexpr int BandRows = 32;
+    /// Columns per tile of the wavefront
+    static constexpr int TileColumns = 128;
+
+    /** @brief Allocates the gray buffer (two bytes per pixel) of a @p width x @p height image. */
+    ErrorDiffusion(int width, int height);
+
+    /** @brief Loads the gray levels of rows [rowBegin, rowEnd); bands may run concurrently. */
+    void loadRows(const Image& image, int rowBegin, int rowEnd);
+
+    /** @brief Number of waves; wave w may start once wave w - 1 has finished. */
+    int waves() const;
+
+    /** @brief Number of tiles of wave @p wave, which may run concurrently. */
+    int tilesInWave(int wave) const;
+
+    /** @brief Diffuses tiles [tileBegin, tileEnd) of wave @p wave. */
+    void diffuseTiles(int wave, int tileBegin, int tileEnd);
+
+    /** @brief Writes rows [rowBegin, rowEnd) as black and white; bands may run concurrently. */
+    void storeRows(Image& image, int rowBegin, int rowEnd) const;
+
+private:
+    void diffuseTile(int band, int tile);
+
+    int width;
+    int height;
+    int bands;
+    int tilesPerBand;
+    int waveStride;                 ///< Waves between tile t of a band and tile t of the next
+    std::vector<std::int16_t> gray; ///< Gray level plus diffused error, then 0 or 255
+};
+
+#endif // DITHER_H
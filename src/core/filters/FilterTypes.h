@@ -0,0 +1,260 @@
+/**
+ * @file FilterTypes.h
+ * @brief Plain C++ parameter types and the progress/status observer used by the filters.
+ *
+ * This file contains the enumerations that select filter variants (flip direction,
+ * rotation angle, brightness mode, frame style) and the FilterObserver interface
+ * through which ImageFilters reports progress and status. None of these types depend
+ * on Qt, so the core library can be linked into headless tools and render servers;
+ * the GUI adapts FilterObserver to its progress bar and status bar.
+ *
+ * @details Cancellation stays a std::atomic<bool> passed to each cancellable filter,
+ * so any thread (a GUI button, a server request timeout) can request it.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef FILTERTYPES_H
+#define FILTERTYPES_H
+
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Axis of a flip.
+ */
+enum class FlipDirection {
+    Horizontal, ///< Mirror left and right
+    Vertical    ///< Mirror top and bottom
+};
+
+/**
+ * @brief Clockwise rotation in multiples of 90 degrees.
+ */
+enum class RotateAngle {
+    Rotate90,
+    Rotate180,
+    Rotate270
+};
+
+/**
+ * @brief Output canvas of a free-angle rotation.
+ */
+enum class RotateCanvas {
+    Expand,    ///< Grow the canvas so the whole rotated image is visible
+    Original,  ///< Keep the input size; corners are cut off
+    CropToFit  ///< Largest axis-aligned rectangle with no background showing
+};
+
+/**
+ * @brief Pixel interpolation used when sampling between source pixels.
+ */
+enum class Interpolation {
+    Nearest,   ///< Closest source pixel (no new colors)
+    Bilinear,  ///< Weighted average of the 2x2 nearest pixels
+    Bicubic    ///< Catmull-Rom cubic over the 4x4 nearest pixels (sharpest)
+};
+
+/**
+ * @brief What geometric transforms sample outside the source image.
+ */
+enum class EdgeMode {
+    Constant,  ///< A background color
+    Clamp,     ///< The nearest border pixel
+    Reflect    ///< The source mirrored at its borders
+};
+
+/**
+ * @brief Reconstruction filter used when resizing an image.
+ */
+enum class ResizeFilter {
+    Nearest,   ///< Closest source pixel (fastest, blocky)
+    Bilinear,  ///< Triangle filter; widened when downscaling so it averages instead of aliasing
+    Bicubic,   ///< Catmull-Rom cubic filter
+    Lanczos,   ///< Lanczos-3 windowed sinc (sharpest; best for thumbnails)
+    Area       ///< Exact area coverage average (box filter; best for large downscales)
+};
+
+/**
+ * @brief Number format used by filters that have both a floating-point and an integer path.
+ */
+enum class Arithmetic {
+    Reference,  ///< Original floating-point formulas
+    FixedPoint  ///< Integer tables and Q8 fixed point; exact or within one level of Reference
+};
+
+/**
+ * @brief Encoding in which filters that mix or scale light do their arithmetic.
+ */
+enum class WorkingSpace {
+    Srgb,   ///< Directly on the stored sRGB levels (original results, fastest)
+    Linear  ///< On linear light (see LinearLight); blends and downscales keep their brightness
+};
+
+/**
+ * @brief How an overlay color b combines with the base color a when compositing.
+ */
+enum class BlendMode {
+    Normal,     ///< b
+    Multiply,   ///< a * b (darkens)
+    Screen,     ///< 1 - (1 - a) * (1 - b) (lightens)
+    Overlay,    ///< Multiply where the base is dark, screen where it is light
+    Add,        ///< a + b, clipped to white
+    Difference  ///< |a - b|
+};
+
+/**
+ * @brief Point of the base image that an overlay is aligned to.
+ *
+ * The same point of the overlay is placed on it, so BottomRight puts the bottom-right
+ * corner of the overlay on the bottom-right corner of the base.
+ */
+enum class Anchor {
+    TopLeft,
+    Top,
+    TopRight,
+    Left,
+    Center,
+    Right,
+    BottomLeft,
+    Bottom,
+    BottomRight
+};
+
+/**
+ * @brief An 8-bit RGB color, used for backgrounds and fills.
+ */
+struct RgbColor {
+    unsigned char r = 255;
+    unsigned char g = 255;
+    unsigned char b = 255;
+};
+
+/**
+ * @brief Morphological operators of ImageFilters::applyMorphology().
+ *
+ * Each channel is processed as a grayscale image, so black-and-white images stay black
+ * and white.
+ */
+enum class MorphologyOp {
+    Erode,    ///< Minimum over the structuring element (shrinks white, grows black)
+    Dilate,   ///< Maximum over the structuring element (grows white)
+    Open,     ///< Erode then dilate: removes white specks smaller than the element
+    Close,    ///< Dilate then erode: fills black specks and gaps smaller than the element
+    Gradient  ///< Dilate minus erode: outlines of shapes
+};
+
+/**
+ * @brief How ImageFilters::applyBlackAndWhite() turns gray levels into black and white.
+ */
+enum class BinarizeMode {
+    Threshold,     ///< White above a fixed threshold
+    Otsu,          ///< White above the threshold that best separates the histogram
+    Bayer,         ///< Ordered dither with an 8x8 Bayer matrix (regular pattern)
+    FloydSteinberg ///< Error diffusion (fine grain, keeps gradients and detail)
+};
+
+/**
+ * @brief How ImageFilters::applyQuantize() chooses its palette.
+ */
+enum class QuantizeMethod {
+    MedianCut, ///< Split the color cube at medians (fast, favours frequent colors)
+    KMeans     ///< Median cut refined by k-means in Lab space (closer to what the eye sees)
+};
+
+/**
+ * @brief Direction of the Dark & Light brightness adjustment.
+ */
+enum class LightMode {
+    Dark,  ///< Darken the image
+    Light  ///< Lighten the image
+};
+
+/**
+ * @brief Decorative frame styles supported by ImageFilters::applyFrame().
+ */
+enum class FrameStyle {
+    Simple,        ///< Blue frame with an inner white border
+    DoubleWhite,   ///< White double border on a dark background
+    SolidBlue,
+    SolidRed,
+    SolidGreen,
+    SolidBlack,
+    SolidWhite,
+    Shadow,        ///< Soft shadow towards the bottom-right
+    GoldDecorated, ///< Gold frame with accent stripes
+    Decorated      ///< Brown/beige frame with accent patterns
+};
+
+/**
+ * @brief Returns the display name of a frame style (as shown in the GUI).
+ */
+inline const char* frameStyleName(FrameStyle style)
+{
+    switch (style) {
+    case FrameStyle::Simple: return "Simple Frame";
+    case FrameStyle::DoubleWhite: return "Double Border - White";
+    case FrameStyle::SolidBlue: return "Solid Frame - Blue";
+    case FrameStyle::SolidRed: return "Solid Frame - Red";
+    case FrameStyle::SolidGreen: return "Solid Frame - Green";
+    case FrameStyle::SolidBlack: return "Solid Frame - Black";
+    case FrameStyle::SolidWhite: return "Solid Frame - White";
+    case FrameStyle::Shadow: return "Shadow Frame";
+    case FrameStyle::GoldDecorated: return "Gold Decorated Frame";
+    case FrameStyle::Decorated: return "Decorated Frame";
+    }
+    return "Decorated Frame";
+}
+
+/**
+ * @brief Parses a frame style from its display name.
+ * @throws std::invalid_argument if @p name is not a known style
+ */
+inline FrameStyle frameStyleFromName(const std::string& name)
+{
+    for (int i = 0; i <= static_cast<int>(FrameStyle::Decorated); ++i) {
+        FrameStyle style = static_cast<FrameStyle>(i);
+        if (name == frameStyleName(style)) return style;
+    }
+    throw std::invalid_argument("Unknown frame style: " + name);
+}
+
+/**
+ * @class FilterObserver
+ * @brief Receives progress and status updates from ImageFilters.
+ *
+ * All callbacks are invoked on the thread that called the filter, never on pool
+ * workers, so implementations may update GUI widgets directly. Every method has an
+ * empty default, so observers only override what they display.
+ */
+class FilterObserver
+{
+public:
+    virtual ~FilterObserver() = default;
+
+    /**
+     * @brief A long-running filter started; progress runs from 0 to @p total.
+     */
+    virtual void progressStarted(int total) { (void)total; }
+
+    /**
+     * @brief @p done of @p total units of work have finished.
+     */
+    virtual void progressChanged(int done, int total) { (void)done; (void)total; }
+
+    /**
+     * @brief The filter finished, failed or was cancelled; hide any progress display.
+     */
+    virtual void progressFinished() {}
+
+    /**
+     * @brief Human-readable status message ("Applying Blur filter...", "Blur filter applied", ...).
+     */
+    virtual void statusChanged(const std::string& message) { (void)message; }
+};
+
+#endif // FILTERTYPES_H
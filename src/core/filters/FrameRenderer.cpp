@@ -0,0 +1,257 @@
+/**
+ * @file FrameRenderer.cpp
+ * @brief Implementation of the frame presets and the span-based frame renderer.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "FrameRenderer.h"
+#include "image/Image_Class.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/// Largest canvas side; keeps every byte offset within a row representable as int
+constexpr long long MaxCanvasSide = std::numeric_limits<int>::max() / 3;
+
+/// Bytes copied per memcpy when replicating a fill pattern, small enough to stay in L1
+constexpr std::size_t FillChunk = 3 * 1024;
+
+/// Fills @p count pixels with @p color: memset for grays, otherwise a 16-pixel seed
+/// replicated with memcpy
+void fillSpan(unsigned char* out, int count, const RgbColor& color)
+{
+    if (count <= 0) return;
+    const std::size_t total = static_cast<std::size_t>(count) * 3;
+    if (color.r == color.g && color.g == color.b) {
+        std::memset(out, color.r, total);
+        return;
+    }
+    const int seed = std::min(count, 16);
+    for (int i = 0; i < seed; ++i) {
+        out[i * 3 + 0] = color.r;
+        out[i * 3 + 1] = color.g;
+        out[i * 3 + 2] = color.b;
+    }
+    // The copied prefix is always a whole number of pixels, so the pattern stays in phase
+    std::size_t done = static_cast<std::size_t>(seed) * 3;
+    while (done < total) {
+        const std::size_t chunk = std::min({done, FillChunk, total - done});
+        std::memcpy(out + done, out, chunk);
+        done += chunk;
+    }
+}
+
+inline void putPixel(unsigned char* row, int x, const RgbColor& color)
+{
+    row[x * 3 + 0] = color.r;
+    row[x * 3 + 1] = color.g;
+    row[x * 3 + 2] = color.b;
+}
+
+/// Non-negative remainder
+inline long long wrap(long long value, long long period)
+{
+    const long long r = value % period;
+    return r < 0 ? r + period : r;
+}
+
+/// Paints the hatch lines of @p band crossing pixels [x0, x1) of canvas row @p y
+void hatchSpan(unsigned char* row, int y, int x0, int x1, const FrameBand& band)
+{
+    const FrameHatch& hatch = band.hatch;
+    if (hatch.period <= 0) return;
+    // Solve x + y + offset = 0 (or x - y + offset = 0) modulo the period for the first x >= x0
+    const long long target = hatch.rising ? static_cast<long long>(y) - hatch.offset
+                                          : -static_cast<long long>(y) - hatch.offset;
+    for (long long x = x0 + wrap(target - x0, hatch.period); x < x1; x += hatch.period) {
+        putPixel(row, static_cast<int>(x), band.color);
+    }
+}
+
+RgbColor brightened(const RgbColor& color, int amount)
+{
+    const auto channel = [amount](unsigned char v) {
+        return static_cast<unsigned char>(std::min(255, v + amount));
+    };
+    return {channel(color.r), channel(color.g), channel(color.b)};
+}
+
+} // namespace
+
+FrameSpec FrameSpec::solid(int width, const RgbColor& color)
+{
+    FrameSpec spec;
+    spec.left = spec.top = spec.right = spec.bottom = width;
+    spec.background = color;
+    return spec;
+}
+
+FrameSpec FrameSpec::fromStyle(FrameStyle style)
+{
+    const RgbColor white{255, 255, 255};
+    switch (style) {
+    case FrameStyle::Simple: {
+        // Blue frame with a white mat drawn 5 pixels inside the picture
+        FrameSpec spec = solid(10, {0, 0, 255});
+        spec.bands.push_back({15, 5, white});
+        return spec;
+    }
+    case FrameStyle::DoubleWhite: {
+        FrameSpec spec = solid(24, {20, 20, 20});
+        spec.bands.push_back({0, 14, white});
+        spec.bands.push_back({18, 6, white});
+        return spec;
+    }
+    case FrameStyle::SolidBlue: return solid(20, {0, 0, 255});
+    case FrameStyle::SolidRed: return solid(20, {255, 0, 0});
+    case FrameStyle::SolidGreen: return solid(20, {0, 255, 0});
+    case FrameStyle::SolidBlack: return solid(20, {0, 0, 0});
+    case FrameStyle::SolidWhite: return solid(20, white);
+    case FrameStyle::Shadow: {
+        FrameSpec spec;
+        spec.left = spec.top = 15;
+        spec.right = spec.bottom = 18;
+        spec.background = {20, 20, 20};
+        spec.shadow = {6, 60};
+        return spec;
+    }
+    case FrameStyle::GoldDecorated: {
+        // Outer gold crossed by two families of accent stripes, then a light inner plate
+        const RgbColor accent{200, 160, 60};
+        FrameSpec spec = solid(22, {180, 140, 40});
+        spec.bands.push_back({3, 13, accent, false, {11, 0, false}});
+        spec.bands.push_back({3, 13, accent, false, {13, 12, true}});
+        spec.bands.push_back({16, 6, {240, 210, 120}});
+        return spec;
+    }
+    case FrameStyle::Decorated:
+        break;
+    }
+
+    // Brown edge, beige field with a diagonal accent pattern, three accent pinstripes and
+    // an accent lip next to the picture
+    const RgbColor accent{180, 140, 80};
+    FrameSpec spec = solid(25, {100, 70, 50});
+    spec.bands.push_back({3, 18, {235, 225, 210}});
+    spec.bands.push_back({3, 18, accent, false, {12, 0, false}});
+    spec.bands.push_back({9, 1, accent});
+    spec.bands.push_back({12, 1, accent});
+    spec.bands.push_back({15, 1, accent});
+    spec.bands.push_back({21, 3, accent});
+    return spec;
+}
+
+FrameRenderer::FrameRenderer(const FrameSpec& spec, int imageWidth, int imageHeight)
+    : spec(spec), imageWidth(imageWidth), imageHeight(imageHeight)
+{
+    if (imageWidth < 1 || imageHeight < 1) {
+        throw std::invalid_argument("Image dimensions must be at least 1x1");
+    }
+    if (spec.left < 0 || spec.top < 0 || spec.right < 0 || spec.bottom < 0) {
+        throw std::invalid_argument("Frame margins must not be negative");
+    }
+    if (spec.shadow.step < 0 || spec.shadow.maximum < 0) {
+        throw std::invalid_argument("Frame shadow must not be negative");
+    }
+    for (const FrameBand& band : spec.bands) {
+        if (band.inset < 0 || band.thickness < 0 || band.hatch.period < 0) {
+            throw std::invalid_argument("Frame bands must not have negative sizes");
+        }
+    }
+    const long long w = static_cast<long long>(imageWidth) + spec.left + spec.right;
+    const long long h = static_cast<long long>(imageHeight) + spec.top + spec.bottom;
+    if (w > MaxCanvasSide || h > MaxCanvasSide) {
+        throw std::invalid_argument("Framed image would be too large");
+    }
+    canvasWidth = static_cast<int>(w);
+    canvasHeight = static_cast<int>(h);
+}
+
+void FrameRenderer::paintMargin(unsigned char* row, int y, int x0, int x1) const
+{
+    if (x1 <= x0) return;
+    const FrameShadow& shadow = spec.shadow;
+    if (shadow.step == 0 || shadow.maximum == 0) {
+        fillSpan(row + static_cast<std::size_t>(x0) * 3, x1 - x0, spec.background);
+        return;
+    }
+
+    // Distance is max(dx, dy) beyond the right and bottom image edges: constant up to
+    // column origin + dy, then a ramp of single pixels until the lift saturates
+    const long long origin = static_cast<long long>(spec.left) + imageWidth;
+    const long long dy = std::max(0LL, static_cast<long long>(y) - spec.top - imageHeight);
+    const long long saturated = (shadow.maximum + shadow.step - 1) / shadow.step;
+    const auto lift = [&](long long d) {
+        return static_cast<int>(std::min<long long>(shadow.maximum, d * shadow.step));
+    };
+
+    const int flatEnd = static_cast<int>(std::clamp<long long>(origin + dy + 1, x0, x1));
+    fillSpan(row + static_cast<std::size_t>(x0) * 3, flatEnd - x0, brightened(spec.background, lift(dy)));
+    int x = flatEnd;
+    for (; x < x1 && x - origin < saturated; ++x) {
+        putPixel(row, x, brightened(spec.background, lift(x - origin)));
+    }
+    fillSpan(row + static_cast<std::size_t>(x) * 3, x1 - x, brightened(spec.background, shadow.maximum));
+}
+
+void FrameRenderer::paintBand(unsigned char* row, int y, const FrameBand& band) const
+{
+    const long long a = band.inset;
+    const long long b = a + band.thickness;
+    const int edgeDistance = std::min(y, canvasHeight - 1 - y);
+    if (band.thickness == 0 || edgeDistance < a || a >= canvasWidth - a) return;
+
+    // Pixels of this row whose distance to the nearest canvas edge lies in [a, b)
+    int spans[2][2];
+    int count = 0;
+    if (edgeDistance < b) {
+        spans[count][0] = static_cast<int>(a);
+        spans[count++][1] = static_cast<int>(canvasWidth - a);
+    } else {
+        const int leftEnd = static_cast<int>(std::min(b, canvasWidth - a));
+        spans[count][0] = static_cast<int>(a);
+        spans[count++][1] = leftEnd;
+        spans[count][0] = static_cast<int>(std::max<long long>(canvasWidth - b, leftEnd));
+        spans[count++][1] = static_cast<int>(canvasWidth - a);
+    }
+
+    for (int i = 0; i < count; ++i) {
+        if (band.solid) {
+            fillSpan(row + static_cast<std::size_t>(spans[i][0]) * 3, spans[i][1] - spans[i][0], band.color);
+        } else {
+            hatchSpan(row, y, spans[i][0], spans[i][1], band);
+        }
+    }
+}
+
+void FrameRenderer::renderRows(const Image& src, Image& dst, int rowBegin, int rowEnd) const
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(std::min(dst.height, canvasHeight), rowEnd);
+    const std::size_t imageBytes = static_cast<std::size_t>(imageWidth) * 3;
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        unsigned char* row = dst.imageData + static_cast<std::size_t>(y) * canvasWidth * 3;
+        const int sy = y - spec.top;
+        if (sy >= 0 && sy < imageHeight) {
+            // Margins and image are disjoint, so every pixel outside the bands is written once
+            paintMargin(row, y, 0, spec.left);
+            std::memcpy(row + static_cast<std::size_t>(spec.left) * 3,
+                        src.imageData + static_cast<std::size_t>(sy) * imageBytes, imageBytes);
+            paintMargin(row, y, spec.left + imageWidth, canvasWidth);
+        } else {
+            paintMargin(row, y, 0, canvasWidth);
+        }
+        for (const FrameBand& band : spec.bands) {
+            paintBand(row, y, band);
+        }
+    }
+}
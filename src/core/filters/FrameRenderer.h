@@ -0,0 +1,139 @@
+/**
+ * @file FrameRenderer.h
+ * @brief Declarative frame descriptions and a span-based frame renderer.
+ *
+ * This file contains the declaration of FrameSpec, which describes a decorative frame as
+ * margins around the image, a background, an optional drop shadow and a list of
+ * rectangular bands, and of the FrameRenderer used by ImageFilters::applyFrame() to draw
+ * a FrameSpec around an image. Every built-in FrameStyle is a FrameSpec preset, so new
+ * styles are added by describing them rather than by writing pixel loops.
+ *
+ * @details A band is the set of canvas pixels whose distance to the nearest canvas edge
+ * lies in [inset, inset + thickness). Within one row a band is therefore at most two
+ * horizontal spans, so the renderer draws every row as a handful of span fills (memset
+ * for gray colors, doubling memcpy otherwise) plus one memcpy of the image row; only
+ * hatch lines and the shadow ramp touch individual pixels.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef FRAMERENDERER_H
+#define FRAMERENDERER_H
+
+class Image;
+#include "FilterTypes.h"
+#include <vector>
+
+/**
+ * @brief Diagonal hatch lines drawn inside a band.
+ *
+ * Pixel (x, y) of the canvas lies on a line when (x + y + offset) mod period == 0, or
+ * (x - y + offset) mod period == 0 for rising lines.
+ */
+struct FrameHatch {
+    int period = 0;      ///< Line spacing in pixels; 0 disables the hatch
+    int offset = 0;      ///< Phase of the lines
+    bool rising = false; ///< Lines run bottom-left to top-right instead of top-left to bottom-right
+};
+
+/**
+ * @brief A rectangular ring of the canvas painted in one color.
+ */
+struct FrameBand {
+    int inset = 0;       ///< Distance from the canvas edge to the outside of the band
+    int thickness = 0;   ///< Width of the band in pixels
+    RgbColor color;
+    bool solid = true;   ///< False paints only the hatch lines and leaves the rest untouched
+    FrameHatch hatch;    ///< Lines painted in @c color (used when @c solid is false)
+};
+
+/**
+ * @brief Gradient cast by the image towards the bottom-right of the canvas.
+ *
+ * A margin pixel at Chebyshev distance d beyond the right and bottom edges of the image
+ * gets the background brightened by min(maximum, d * step) on every channel.
+ */
+struct FrameShadow {
+    int step = 0;        ///< Brightness added per pixel of distance; 0 disables the shadow
+    int maximum = 0;     ///< Largest brightness added
+};
+
+/**
+ * @brief Declarative description of a frame.
+ *
+ * The canvas is the image enlarged by the four margins. Painting order is: background
+ * (with the shadow) in the margins, the image, then the bands in list order. Bands may
+ * reach into the image area, which draws a mat over the picture.
+ *
+ * @example
+ * @code
+ * FrameSpec spec;
+ * spec.left = spec.top = spec.right = spec.bottom = 30;
+ * spec.background = {40, 40, 40};
+ * spec.bands.push_back({4, 6, {255, 255, 255}});
+ * filters.applyFrame(image, spec);
+ * @endcode
+ */
+struct FrameSpec {
+    int left = 0;
+    int top = 0;
+    int right = 0;
+    int bottom = 0;
+    RgbColor background;
+    FrameShadow shadow;
+    std::vector<FrameBand> bands;
+
+    /**
+     * @brief Frame of equal @p width on all sides in a single color.
+     */
+    static FrameSpec solid(int width, const RgbColor& color);
+
+    /**
+     * @brief Description of a built-in frame style.
+     */
+    static FrameSpec fromStyle(FrameStyle style);
+};
+
+/**
+ * @class FrameRenderer
+ * @brief Draws a FrameSpec around images of one size.
+ */
+class FrameRenderer
+{
+public:
+    /**
+     * @brief Prepares a frame for a @p imageWidth x @p imageHeight image.
+     * @throws std::invalid_argument if the spec has negative sizes or the canvas is too large
+     */
+    FrameRenderer(const FrameSpec& spec, int imageWidth, int imageHeight);
+
+    /** @brief Width of the framed image. */
+    int width() const { return canvasWidth; }
+    /** @brief Height of the framed image. */
+    int height() const { return canvasHeight; }
+
+    /**
+     * @brief Renders rows [rowBegin, rowEnd) of the framed image.
+     * @param src Image to frame, of the size given to the constructor
+     * @param dst Destination of width() x height() pixels (must not alias @p src)
+     * @param rowBegin First canvas row
+     * @param rowEnd One past the last canvas row
+     */
+    void renderRows(const Image& src, Image& dst, int rowBegin, int rowEnd) const;
+
+private:
+    void paintMargin(unsigned char* row, int y, int x0, int x1) const;
+    void paintBand(unsigned char* row, int y, const FrameBand& band) const;
+
+    FrameSpec spec;
+    int imageWidth;
+    int imageHeight;
+    int canvasWidth;
+    int canvasHeight;
+};
+
+#endif // FRAMERENDERER_H
@@ -0,0 +1,149 @@
+/**
+ * @file GeometricTransform.cpp
+ * @brief Implementation of 2-D affine and projective transforms.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "GeometricTransform.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+double determinant(const std::array<double, 9>& m)
+{
+    return m[0] * (m[4] * m[8] - m[5] * m[7])
+         - m[1] * (m[3] * m[8] - m[5] * m[6])
+         + m[2] * (m[3] * m[7] - m[4] * m[6]);
+}
+
+/// Largest absolute coefficient, used to make singularity tests scale-independent
+double magnitude(const std::array<double, 9>& m)
+{
+    double largest = 0.0;
+    for (double v : m) largest = std::max(largest, std::fabs(v));
+    return largest;
+}
+
+bool isSingular(const std::array<double, 9>& m)
+{
+    const double scale = magnitude(m);
+    return scale == 0.0 || !std::isfinite(scale) || std::fabs(determinant(m)) <= 1e-12 * scale * scale * scale;
+}
+
+} // namespace
+
+GeometricTransform::GeometricTransform()
+    : m{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}
+{
+}
+
+GeometricTransform::GeometricTransform(const std::array<double, 9>& matrix)
+    : m(matrix)
+{
+}
+
+GeometricTransform GeometricTransform::affine(double a, double b, double c, double d, double e, double f)
+{
+    return homography({a, b, c, d, e, f, 0.0, 0.0, 1.0});
+}
+
+GeometricTransform GeometricTransform::homography(const std::array<double, 9>& matrix)
+{
+    if (isSingular(matrix)) {
+        throw std::invalid_argument("Transform matrix is singular");
+    }
+    // Homogeneous coordinates are scale-free; keep w positive at the origin so map() can
+    // tell points in front of the projection center from points behind it
+    if (matrix[8] < 0.0) {
+        std::array<double, 9> negated;
+        for (int i = 0; i < 9; ++i) negated[i] = -matrix[i];
+        return GeometricTransform(negated);
+    }
+    return GeometricTransform(matrix);
+}
+
+GeometricTransform GeometricTransform::quadToQuad(const std::array<double, 8>& from, const std::array<double, 8>& to)
+{
+    // Solve for h0..h7 (h8 = 1) from u = (h0 x + h1 y + h2) / (h6 x + h7 y + 1) and the same for v
+    double a[8][9] = {};
+    for (int i = 0; i < 4; ++i) {
+        const double x = from[i * 2], y = from[i * 2 + 1];
+        const double u = to[i * 2], v = to[i * 2 + 1];
+        double* r0 = a[i * 2];
+        double* r1 = a[i * 2 + 1];
+        r0[0] = x; r0[1] = y; r0[2] = 1.0; r0[6] = -x * u; r0[7] = -y * u; r0[8] = u;
+        r1[3] = x; r1[4] = y; r1[5] = 1.0; r1[6] = -x * v; r1[7] = -y * v; r1[8] = v;
+    }
+
+    // Gaussian elimination with partial pivoting
+    for (int col = 0; col < 8; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < 8; ++row) {
+            if (std::fabs(a[row][col]) > std::fabs(a[pivot][col])) pivot = row;
+        }
+        if (std::fabs(a[pivot][col]) < 1e-12) {
+            throw std::invalid_argument("Perspective points are degenerate (three of them are collinear)");
+        }
+        if (pivot != col) {
+            for (int k = 0; k < 9; ++k) std::swap(a[pivot][k], a[col][k]);
+        }
+        for (int row = 0; row < 8; ++row) {
+            if (row == col) continue;
+            const double factor = a[row][col] / a[col][col];
+            for (int k = col; k < 9; ++k) a[row][k] -= factor * a[col][k];
+        }
+    }
+
+    std::array<double, 9> h;
+    for (int i = 0; i < 8; ++i) h[i] = a[i][8] / a[i][i];
+    h[8] = 1.0;
+    return homography(h);
+}
+
+GeometricTransform GeometricTransform::inverse() const
+{
+    const double det = determinant(m);
+    if (isSingular(m)) {
+        throw std::invalid_argument("Transform matrix is singular");
+    }
+    const double s = 1.0 / det;
+    return GeometricTransform({
+        (m[4] * m[8] - m[5] * m[7]) * s, (m[2] * m[7] - m[1] * m[8]) * s, (m[1] * m[5] - m[2] * m[4]) * s,
+        (m[5] * m[6] - m[3] * m[8]) * s, (m[0] * m[8] - m[2] * m[6]) * s, (m[2] * m[3] - m[0] * m[5]) * s,
+        (m[3] * m[7] - m[4] * m[6]) * s, (m[1] * m[6] - m[0] * m[7]) * s, (m[0] * m[4] - m[1] * m[3]) * s,
+    });
+}
+
+GeometricTransform GeometricTransform::then(const GeometricTransform& next) const
+{
+    std::array<double, 9> r;
+    const std::array<double, 9>& n = next.m;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            r[row * 3 + col] = n[row * 3] * m[col] + n[row * 3 + 1] * m[3 + col] + n[row * 3 + 2] * m[6 + col];
+        }
+    }
+    return GeometricTransform(r);
+}
+
+bool GeometricTransform::isAffine() const
+{
+    return m[6] == 0.0 && m[7] == 0.0 && m[8] != 0.0;
+}
+
+bool GeometricTransform::map(double x, double y, double& outX, double& outY) const
+{
+    const double w = m[6] * x + m[7] * y + m[8];
+    if (!(w > 1e-12 * magnitude(m))) return false;
+    outX = (m[0] * x + m[1] * y + m[2]) / w;
+    outY = (m[3] * x + m[4] * y + m[5]) / w;
+    return true;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file GeometricTransform.h
+ * @brief 2-D affine and projective (homography) transforms.
+ *
+ * This file contains the declaration of the GeometricTransform class consumed by
+ * ImageFilters::applyTransform() and ImageFilters::applyPerspectiveCorrect(). A transform
+ * is a 3x3 matrix in row-major order mapping source image coordinates to output image
+ * coordinates; affine transforms have the bottom row (0, 0, 1).
+ *
+ * @details Coordinates are continuous: pixel (i, j) covers [i, i + 1) x [j, j + 1), so
+ * the top-left corner of the image is (0, 0) and the bottom-right corner is
+ * (width, height). A transform can be built from six affine coefficients, nine
+ * homography coefficients, or four point correspondences (quadToQuad()).
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef GEOMETRICTRANSFORM_H
+#define GEOMETRICTRANSFORM_H
+
+#include <array>
+
+/**
+ * @class GeometricTransform
+ * @brief A 3x3 projective transform of the image plane.
+ */
+class GeometricTransform
+{
+public:
+    /**
+     * @brief Creates the identity transform.
+     */
+    GeometricTransform();
+
+    /**
+     * @brief Affine transform x' = a x + b y + c, y' = d x + e y + f.
+     */
+    static GeometricTransform affine(double a, double b, double c, double d, double e, double f);
+
+    /**
+     * @brief Projective transform from a row-major 3x3 matrix.
+     * @throws std::invalid_argument if the matrix is singular
+     */
+    static GeometricTransform homography(const std::array<double, 9>& matrix);
+
+    /**
+     * @brief Homography mapping four points onto four other points.
+     * @param from Source points x0, y0, x1, y1, x2, y2, x3, y3
+     * @param to Destination points in the same order
+     * @throws std::invalid_argument if three of the points are collinear
+     */
+    static GeometricTransform quadToQuad(const std::array<double, 8>& from, const std::array<double, 8>& to);
+
+    /**
+     * @brief Returns the inverse transform.
+     * @throws std::invalid_argument if the transform is singular
+     */
+    GeometricTransform inverse() const;
+
+    /**
+     * @brief Returns the transform applying this one, then @p next.
+     */
+    GeometricTransform then(const GeometricTransform& next) const;
+
+    /**
+     * @brief True if the bottom row is (0, 0, 1) up to scale.
+     */
+    bool isAffine() const;
+
+    /**
+     * @brief Maps a point.
+     * @return False if the point maps to infinity or behind the projection center
+     */
+    bool map(double x, double y, double& outX, double& outY) const;
+
+    /**
+     * @brief Row-major 3x3 coefficients.
+     */
+    const std::array<double, 9>& matrix() const { return m; }
+
+private:
+    explicit GeometricTransform(const std::array<double, 9>& matrix);
+
+    std::array<double, 9> m;
+};
+
+#endif // GEOMETRICTRANSFORM_H
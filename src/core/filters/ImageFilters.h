@@ -1,6 +1,6 @@
 /**
  * @file ImageFilters.h
- * @brief Image processing filters with Qt integration, progress tracking, and cancellation support.
+ * @brief Image processing filters with progress tracking and cancellation support.
  * 
  * This file contains the declaration of the ImageFilters class, which provides a comprehensive
  * set of image processing operations including basic filters (grayscale, invert), geometric
@@ -8,15 +8,15 @@
  * and special filters (TV/CRT, purple tint). All filters support progress tracking and
  * cancellation for long-running operations.
  * 
- * @details The ImageFilters class is designed to work seamlessly with Qt's GUI framework,
- * providing real-time progress updates and the ability to cancel operations mid-execution.
- * It uses atomic operations for thread-safe cancellation and integrates with Qt's progress
- * bar and status bar components.
+ * @details The ImageFilters class has no GUI dependency: progress and status updates go
+ * through a FilterObserver, which the Qt application adapts to its progress bar and
+ * status bar, and which headless tools may omit. It uses atomic operations for
+ * thread-safe cancellation.
  * 
  * @features
  * - Progress tracking for all long-running operations
  * - Cancellation support using atomic flags
- * - Qt integration with progress bars and status updates
+ * - Progress and status reporting through the FilterObserver interface
  * - Comprehensive error handling and exception safety
  * - Support for various image formats through the Image class
  * - Memory-efficient processing with in-place operations where possible
@@ -38,10 +38,18 @@
 // Forward declaration to avoid including the full Image_Class.h implementation
 class Image;
 #undef pixel  // Undefine the pixel macro to avoid conflicts with Qt
-class QProgressBar; // forward declaration to avoid heavy Qt includes in header
-class QStatusBar;   // forward declaration
-class QString;      // forward declaration
+class PointOp;      // forward declaration (see PointOp.h)
+class FilterPipeline; // forward declaration (see pipeline/FilterPipeline.h)
+class GeometricTransform; // forward declaration (see GeometricTransform.h)
+struct FrameSpec;         // forward declaration (see FrameRenderer.h)
+struct CompositeOptions;  // forward declaration (see Compositor.h)
+#include "FilterTypes.h"
+#include <array>
 #include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
 #include <cmath>
 #include <algorithm>
 #include <random>
@@ -49,11 +57,11 @@ class QString;      // forward declaration
 
 /**
  * @class ImageFilters
- * @brief Comprehensive image processing class with Qt integration and cancellation support.
+ * @brief Comprehensive image processing class with progress reporting and cancellation support.
  * 
- * The ImageFilters class provides a complete suite of image processing operations designed
- * to work seamlessly with Qt applications. It supports progress tracking, cancellation,
- * and real-time status updates for all operations.
+ * The ImageFilters class provides a complete suite of image processing operations usable
+ * from GUI applications and headless processes alike. It supports progress tracking,
+ * cancellation, and real-time status updates for all operations.
  * 
  * @details This class implements various image processing algorithms including:
  * - Basic color operations (grayscale, invert, black & white)
@@ -62,26 +70,59 @@ class QString;      // forward declaration
  * - Special effects (TV/CRT simulation, purple tint, frame addition)
  * - Image combination (merge operations)
  * 
- * All long-running operations support cancellation and progress tracking through Qt's
- * progress bar and status bar components.
+ * All long-running operations support cancellation and progress tracking through a
+ * FilterObserver.
  * 
- * @note This class is designed to work with the Image class and requires Qt 6.8.1 or later.
+ * @note This class is designed to work with the Image class and does not depend on Qt.
  * @see Image class for image data structure and basic operations
- * @see QProgressBar for progress tracking
- * @see QStatusBar for status updates
+ * @see FilterObserver for progress tracking and status updates
  */
 class ImageFilters
 {
 public:
     /**
-     * @brief Constructs an ImageFilters object with Qt UI components.
+     * @brief Constructs an ImageFilters object.
      * 
-     * @param progressBar Pointer to QProgressBar for progress tracking (can be nullptr)
-     * @param statusBar Pointer to QStatusBar for status updates (can be nullptr)
+     * @param observer Receiver of progress and status updates (can be nullptr)
      * 
-     * @note Both parameters are optional. If nullptr, progress and status updates will be skipped.
+     * @note If nullptr, progress and status updates are skipped. The observer is not
+     *       owned and must outlive this object.
      */
-    ImageFilters(QProgressBar* progressBar, QStatusBar* statusBar);
+    explicit ImageFilters(FilterObserver* observer = nullptr);
+    
+    /**
+     * @brief Selects the floating-point reference formulas or the fixed-point paths.
+     * 
+     * Affects the TV/CRT, Infrared and Fish-Eye filters. FixedPoint (the default) uses
+     * integer tables for TV/CRT and Infrared, which are bit-identical to Reference, and
+     * Q8 bilinear sampling for Fish-Eye, which is within one level of it. Sunlight and
+     * Purple are lookup tables (PointOp) and identical in both modes.
+     * 
+     * @param mode Arithmetic used by subsequent calls
+     */
+    void setArithmetic(Arithmetic mode);
+    
+    /**
+     * @brief The arithmetic selected with setArithmetic().
+     */
+    Arithmetic arithmetic() const { return arithmeticMode; }
+    
+    /**
+     * @brief Selects whether pixels are mixed as stored sRGB levels or as linear light.
+     * 
+     * Affects Merge, Blur, Resize (all filters but Nearest) and Dark & Light. Srgb (the
+     * default) keeps their original results. Linear converts through the LinearLight
+     * tables inside each filter's own pass: merges and downscales no longer darken
+     * fine detail and high-contrast edges, and Dark & Light acts like an exposure change.
+     * 
+     * @param space Working space used by subsequent calls
+     */
+    void setWorkingSpace(WorkingSpace space);
+    
+    /**
+     * @brief The working space selected with setWorkingSpace().
+     */
+    WorkingSpace workingSpace() const { return workingSpaceMode; }
     
     // ============================================================================
     // BASIC COLOR FILTERS (with progress tracking and cancellation)
@@ -119,23 +160,47 @@ public:
      * - Random noise for authentic TV feel
      * - Brightness-based color adjustments
      * 
+     * The noise seed comes from the clock and is reported in the status message.
+     * 
      * @note This is a long-running operation that can be cancelled.
      */
     void applyTVFilter(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
     
+    /**
+     * @brief Applies the TV/CRT effect with a given noise seed.
+     * 
+     * The noise of every pixel is a pure function of (seed, x, y) (see CounterRng), so
+     * equal seeds give bit-identical output regardless of thread count, run or machine.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param seed Noise seed
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyTVFilter(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                       std::uint64_t seed);
+    
     /**
      * @brief Converts the image to pure black and white (binary).
      * 
-     * Applies a threshold-based conversion where pixels above 127 become white (255)
-     * and pixels below become black (0). This operation supports progress tracking and cancellation.
+     * By default applies a threshold-based conversion where pixels above 127 become white (255)
+     * and pixels below become black (0). Otsu picks the threshold from the histogram
+     * instead; Bayer and Floyd-Steinberg halftone the image so gray levels survive as
+     * dot density (see Dither). This operation supports progress tracking and cancellation.
      * 
      * @param currentImage Reference to the image to process (modified in-place)
      * @param preFilterImage Reference to store the original image state for cancellation
      * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param mode Conversion to use
+     * @param threshold Gray level above which pixels become white, clamped to [0, 255];
+     *        used by BinarizeMode::Threshold only
      * 
      * @note This is a long-running operation that can be cancelled.
      */
-    void applyBlackAndWhite(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
+    void applyBlackAndWhite(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                            BinarizeMode mode = BinarizeMode::Threshold, int threshold = 127);
     
     /**
      * @brief Inverts all color values in the image.
@@ -158,8 +223,8 @@ public:
     /**
      * @brief Merges the current image with another image.
      * 
-     * Combines two images by averaging their pixel values. The resulting image
-     * will have the dimensions of the smaller input image.
+     * Combines two images by averaging their pixel values where they overlap, with
+     * their top-left corners aligned. The current image keeps its dimensions.
      * 
      * @param currentImage Reference to the first image (modified in-place)
      * @param mergeImage Reference to the second image to merge with
@@ -168,65 +233,144 @@ public:
      */
     void applyMerge(Image& currentImage, Image& mergeImage);
     
+    /**
+     * @brief Composites an overlay onto the current image.
+     * 
+     * Places @p overlay at its anchor plus offset and blends it with the chosen
+     * BlendMode, opacity and optional alpha mask. Only the region where the overlay
+     * lands on the image changes; the image keeps its dimensions. Suited to
+     * watermarks and brand assets as well as full-size merges.
+     * 
+     * @param currentImage Reference to the base image (modified in-place)
+     * @param overlay Image placed on top (must not alias @p currentImage)
+     * @param options Blend mode, opacity, anchor, offset and mask
+     * 
+     * @note This is an immediate operation without progress tracking.
+     * @see Compositor for the fixed-point blend formulas
+     */
+    void applyMerge(Image& currentImage, const Image& overlay, const CompositeOptions& options);
+    
     /**
      * @brief Flips the image horizontally or vertically.
      * 
      * @param currentImage Reference to the image to flip (modified in-place)
-     * @param direction String specifying flip direction: "Horizontal" or "Vertical"
+     * @param direction Flip axis
+     * 
+     * @details Both directions work in place in parallel row bands, in about one pass
+     * over memory. Rows are reversed 16 pixels at a time with byte shuffles when built
+     * for SSSE3 (PHOTOSMITH_NATIVE_ARCH), or pixel by pixel otherwise; a vertical flip
+     * exchanges whole rows with memcpy through one row buffer.
      * 
      * @note This is an immediate operation without progress tracking.
-     * @throws std::invalid_argument if direction is not "Horizontal" or "Vertical"
      */
-    void applyFlip(Image& currentImage, const QString& direction);
+    void applyFlip(Image& currentImage, FlipDirection direction);
     
     /**
      * @brief Rotates the image by the specified angle.
      * 
      * @param currentImage Reference to the image to rotate (modified in-place)
-     * @param angle String specifying rotation angle: "90°", "180°", or "270°"
+     * @param angle Clockwise rotation angle
+     * 
+     * @details 180 degrees swaps mirrored rows in place. 90 and 270 degrees transpose
+     * 32x32-pixel tiles in parallel bands into a new buffer that replaces the old one
+     * without a copy, so large scans are limited by memory bandwidth rather than TLB misses.
+     * 
+     * @note This is an immediate operation without progress tracking.
+     */
+    void applyRotate(Image& currentImage, RotateAngle angle);
+    
+    /**
+     * @brief Rotates the image by an arbitrary angle.
+     * 
+     * @param currentImage Reference to the image to rotate (modified in-place)
+     * @param angleDegrees Clockwise rotation angle in degrees (negative rotates counter-clockwise)
+     * @param interpolation Sampling used for the rotated pixels
+     * @param canvas Expand to fit the whole rotated image, keep the original size, or crop
+     *        to the largest rectangle that contains no background
+     * @param background Fill color of uncovered canvas areas
+     * 
+     * @details Every output pixel is mapped back into the source and sampled there, in
+     * parallel row bands of 128-pixel column tiles so the source reads stay cache-local.
+     * Bilinear sampling in Arithmetic::FixedPoint uses Sampler::samplePointsFixed(), which
+     * gathers eight pixels at a time with AVX2 (within one level of Reference).
+     * Exact multiples of 90 degrees on an expanded canvas use the lossless
+     * applyRotate(Image&, RotateAngle) path; small angles suit deskewing scanned pages.
      * 
      * @note This is an immediate operation without progress tracking.
-     * @throws std::invalid_argument if angle is not "90°", "180°", or "270°"
      */
-    void applyRotate(Image& currentImage, const QString& angle);
+    void applyRotate(Image& currentImage, double angleDegrees,
+                     Interpolation interpolation = Interpolation::Bilinear,
+                     RotateCanvas canvas = RotateCanvas::Expand,
+                     RgbColor background = RgbColor());
     
     /**
      * @brief Adjusts image brightness (darken or lighten).
      * 
      * @param currentImage Reference to the image to adjust (modified in-place)
-     * @param choice String specifying adjustment: "dark" or "light"
+     * @param mode Dark or Light
      * 
      * @details:
-     * - "dark": Divides each pixel value by 3 (makes image darker)
-     * - "light": Multiplies each pixel value by 2, clamped to 255 (makes image brighter)
+     * - Dark: Divides each pixel value by 3 (makes image darker)
+     * - Light: Multiplies each pixel value by 2, clamped to 255 (makes image brighter)
      * 
      * @note This is an immediate operation without progress tracking.
-     * @throws std::invalid_argument if choice is not "dark" or "light"
      */
-    void applyDarkAndLight(Image& currentImage, const QString& choice);
+    void applyDarkAndLight(Image& currentImage, LightMode mode);
     /**
      * @brief Adjusts image brightness by a given percentage.
      *
      * @param currentImage Reference to the image to adjust (modified in-place)
-     * @param choice "dark" to darken, "light" to lighten
+     * @param mode Dark to darken, Light to lighten
      * @param percent Percentage in [0, 100]; 0 = no change, 100 = full effect
      */
-    void applyDarkAndLight(Image& currentImage, const QString& choice, int percent);
+    void applyDarkAndLight(Image& currentImage, LightMode mode, int percent);
+
+    /**
+     * @brief Applies a chain of per-channel point operations in a single pass.
+     *
+     * The operations are composed into one lookup table per channel before any
+     * pixel is touched, so a chain such as lighten -> purple -> invert costs one
+     * pass over the image instead of one pass (and one temporary) per filter.
+     *
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param ops Point operations in application order
+     *
+     * @note This is an immediate operation without progress tracking.
+     * @see PointOp for the available operations
+     */
+    void applyPointOps(Image& currentImage, const std::vector<PointOp>& ops);
     
     /**
      * @brief Adds a decorative frame around the image.
      * 
      * @param currentImage Reference to the image to frame (modified in-place)
-     * @param frameType String specifying frame style: "Simple Frame" or "Decorated Frame"
+     * @param style Frame style
      * 
      * @details:
-     * - "Simple Frame": Blue outer border with white inner border
-     * - "Decorated Frame": Brown/beige decorative frame with accent patterns
+     * - Simple: Blue outer border with white inner border
+     * - DoubleWhite, Solid*: Plain borders
+     * - Shadow: Soft shadow towards the bottom-right
+     * - GoldDecorated, Decorated: Ornate frames with accent patterns
      * 
      * @note This is an immediate operation without progress tracking.
-     * @throws std::invalid_argument if frameType is not "Simple Frame" or "Decorated Frame"
+     * @see frameStyleFromName() to map display names to styles
+     * @see FrameSpec::fromStyle() for the description of each style
+     */
+    void applyFrame(Image& currentImage, FrameStyle style);
+    
+    /**
+     * @brief Adds a frame described by a FrameSpec around the image.
+     * 
+     * The canvas grows by the spec margins. Every row is rendered once as span fills for
+     * the margins and bands plus one copy of the image row, so framing costs about as
+     * much as copying the image.
+     * 
+     * @param currentImage Reference to the image to frame (modified in-place)
+     * @param spec Margins, background, shadow and bands of the frame
+     * 
+     * @note Invalid specs (negative sizes) report "Filter failed" and leave the image unchanged.
      */
-    void applyFrame(Image& currentImage, const QString& frameType);
+    void applyFrame(Image& currentImage, const FrameSpec& spec);
     
     /**
      * @brief Detects and highlights edges in the image.
@@ -238,33 +382,65 @@ public:
      * 
      * @details The algorithm:
      * 1. Converts to grayscale using weighted average (0.299R + 0.587G + 0.114B)
-     * 2. Applies 5x5 Gaussian blur to reduce noise
+     * 2. Applies 5x5 Gaussian blur to reduce noise (separable [1 4 6 4 1] passes)
      * 3. Uses 3x3 Sobel kernels for edge detection
      * 4. Calculates gradient magnitude and applies threshold
      * 
+     * The three stages run fused in a single pass over row bands: each band streams
+     * rows through small ring buffers instead of materializing intermediate images.
+     * 
      * @note This is an immediate operation without progress tracking.
      */
     void applyEdges(Image& currentImage);
+
+    /**
+     * @brief Detects thin, connected edges with the Canny algorithm.
+     * 
+     * Uses the same grayscale, Gaussian and Sobel stages as applyEdges(), then keeps only
+     * pixels whose gradient magnitude is a local maximum across the edge (non-maximum
+     * suppression) and links them by double-threshold hysteresis. The result shows
+     * one-pixel-wide black edges on a white background. The outer 3 pixels are never
+     * edges, so the image border itself is not traced as a contour.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param lowThreshold Minimum gradient magnitude for a pixel to continue an edge
+     * @param highThreshold Minimum gradient magnitude for a pixel to start an edge
+     * 
+     * @details Suppression is fused into the banded gradient pass. Hysteresis floods each
+     * band from its strong pixels in parallel, then propagates across band boundaries in
+     * wavefront rounds until no band gains new edge pixels. Magnitudes use the same units
+     * as the fixed threshold (50) of applyEdges().
+     * 
+     * @note This is an immediate operation without progress tracking. Thresholds with
+     *       low > high or low < 0 fail with a "Filter failed" status.
+     */
+    void applyCanny(Image& currentImage, int lowThreshold = 50, int highThreshold = 100);
     
     /**
      * @brief Resizes the image to specified dimensions.
      * 
-     * Uses nearest-neighbor interpolation for resizing. The aspect ratio is not preserved.
+     * The aspect ratio is not preserved. Nearest-neighbor keeps the original fast behavior;
+     * the other filters are separable convolutions whose weights are computed once per
+     * column and row, then applied in parallel row bands with fixed-point arithmetic.
      * 
      * @param currentImage Reference to the image to resize (modified in-place)
      * @param width New width in pixels
      * @param height New height in pixels
+     * @param filter Reconstruction filter; Lanczos suits thumbnails, Area large downscales
      * 
      * @note This is an immediate operation without progress tracking.
-     * @throws std::invalid_argument if width or height is less than 1
+     * @note A width or height less than 1 reports "Filter failed" and leaves the image unchanged.
+     * @see Resampler
      */
-    void applyResize(Image& currentImage, int width, int height);
+    void applyResize(Image& currentImage, int width, int height, ResizeFilter filter = ResizeFilter::Nearest);
     
     /**
      * @brief Skews the image horizontally by a given angle in degrees.
      * 
      * Creates a shearing effect along the X axis. The resulting canvas width
      * increases to accommodate the skewed content and is filled with white.
+     * Rows are shifted by sub-pixel amounts with bilinear sampling through a
+     * cached WarpEngine remap table.
      * 
      * @param currentImage Reference to the image to skew (modified in-place)
      * @param angleDegrees Skew angle in degrees (positive skews right, negative left)
@@ -273,6 +449,47 @@ public:
      */
     void applySkew(Image& currentImage, double angleDegrees = 40.0);
 
+    /**
+     * @brief Applies an affine or perspective transform.
+     * 
+     * @param currentImage Reference to the image to transform (modified in-place)
+     * @param transform Mapping from source to output coordinates
+     * @param interpolation Sampling used for the transformed pixels
+     * @param edge What samples outside the source read
+     * @param background Fill color for EdgeMode::Constant
+     * @param fitOutput If true the canvas is the bounding box of the transformed image;
+     *        if false it keeps the input size and position
+     * 
+     * @details Output pixels are mapped back through the inverse transform by stepping the
+     * source coordinates incrementally along each row, in parallel row bands of 128-pixel
+     * column tiles. Affine transforms step linearly; homographies step the homogeneous
+     * coordinates and divide once per pixel.
+     * 
+     * @note This is an immediate operation without progress tracking.
+     * @note Transforms that send part of the image to infinity, or need a canvas larger than
+     *       32768 pixels on a side, report "Filter failed" and leave the image unchanged.
+     */
+    void applyTransform(Image& currentImage, const GeometricTransform& transform,
+                        Interpolation interpolation = Interpolation::Bilinear,
+                        EdgeMode edge = EdgeMode::Constant, RgbColor background = RgbColor(),
+                        bool fitOutput = true);
+    
+    /**
+     * @brief Rectifies a quadrilateral (a photographed page or whiteboard) into a rectangle.
+     * 
+     * @param currentImage Reference to the image to correct (modified in-place)
+     * @param corners Source corners x, y in the order top-left, top-right, bottom-right,
+     *        bottom-left, in pixel coordinates
+     * @param width Output width; 0 uses the longer of the top and bottom edges
+     * @param height Output height; 0 uses the longer of the left and right edges
+     * @param interpolation Sampling used for the rectified pixels
+     * 
+     * @note This is an immediate operation without progress tracking.
+     */
+    void applyPerspectiveCorrect(Image& currentImage, const std::array<double, 8>& corners,
+                                 int width = 0, int height = 0,
+                                 Interpolation interpolation = Interpolation::Bicubic);
+
     // ===================== ADDITIONAL EFFECT FILTERS (immediate) =====================
     /** Emboss effect producing a relief-like grayscale. */
     void applyEmboss(Image& currentImage);
@@ -282,7 +499,7 @@ public:
     void applyOilPainting(Image& currentImage, int radius = 3, int intensity = 30);
     /** Enhance sunlight (boost warm channels). */
     void applyEnhanceSunlight(Image& currentImage);
-    /** Fish-eye lens distortion effect. */
+    /** Fish-eye lens distortion effect (bilinear; the lens remap table is cached per image size). */
     void applyFishEye(Image& currentImage);
     
     // ============================================================================
@@ -307,6 +524,149 @@ public:
      * @param strength Percent in [0,100], mapped to kernel radius.
      */
     void applyBlur(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int strength);
+
+    /**
+     * @brief Sharpens the image with an unsharp mask.
+     * 
+     * Adds @p amount percent of the difference between each pixel and its box average
+     * over a (2 * radius + 1)^2 window. Differences up to @p threshold are left alone so
+     * smooth areas and noise are not sharpened. The typical last step after downscaling.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param amount Strength in percent, clamped to [0, 500]
+     * @param radius Window radius, clamped to [1, 50]
+     * @param threshold Smallest difference that is sharpened, clamped to [0, 255]
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyUnsharpMask(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                          int amount = 100, int radius = 2, int threshold = 0);
+
+    /**
+     * @brief Sharpens the image by overlaying its high-pass detail.
+     * 
+     * Overlay-blends 128 + (pixel - box average) onto the image and mixes the result in
+     * by @p amount percent, which boosts local contrast without strong halos.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param amount Strength in percent, clamped to [0, 500]
+     * @param radius Window radius of the high-pass, clamped to [1, 50]
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyHighPass(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                       int amount = 100, int radius = 3);
+
+    /**
+     * @brief Removes salt-and-pepper noise with a median filter.
+     * 
+     * Every channel is replaced by the median of its (2 * radius + 1)-pixel square
+     * window, edges replicated. The cost per pixel does not depend on the radius (see
+     * MedianFilter), and tiles of the image are filtered in parallel.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param radius Window radius, clamped to [1, 50]
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyMedian(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int radius = 1);
+
+    /**
+     * @brief Smooths the image while preserving edges (bilateral filter).
+     * 
+     * Averages each pixel with neighbours that are both close (within about
+     * @p sigmaSpatial pixels) and of similar brightness (within about @p sigmaRange
+     * levels), which softens skin and noise but keeps edges crisp. Uses a bilateral grid
+     * (see BilateralGrid), so the cost does not grow with the spatial sigma.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param sigmaSpatial Spatial standard deviation in pixels, clamped to [2, 500]
+     * @param sigmaRange Brightness standard deviation in 0..255 levels, clamped to [2, 255]
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyBilateral(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                        double sigmaSpatial = 8.0, double sigmaRange = 20.0);
+
+    /**
+     * @brief Applies a morphological operator with a rectangular structuring element.
+     * 
+     * Typically run after applyBlackAndWhite() to clean scanned documents: Open removes
+     * white specks, Close fills pinholes and breaks in strokes. Every channel is
+     * processed as a grayscale image, so photos work too. The cost per pixel does not
+     * depend on the element size (see Morphology).
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param op Operator to apply
+     * @param elementWidth Width of the rectangle in pixels, clamped to [1, 255]
+     * @param elementHeight Height of the rectangle in pixels, clamped to [1, 255]
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyMorphology(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                         MorphologyOp op, int elementWidth = 3, int elementHeight = 3);
+
+    /**
+     * @brief Spreads the gray levels evenly over the full range (histogram equalization).
+     * 
+     * Builds one tone curve from the gray-level histogram (see Image::histogram()) and
+     * applies it to every channel, which brings out detail in flat or faded images.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyEqualize(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
+
+    /**
+     * @brief Equalizes contrast locally (contrast-limited adaptive histogram equalization).
+     * 
+     * Equalizes each tile of a @p tilesX x @p tilesY grid on its own, limiting the
+     * contrast gain to @p clipLimit, and blends neighbouring tiles smoothly (see Clahe).
+     * Recovers detail in both the shadows and highlights of unevenly lit scans.
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param tilesX Tiles across, clamped to [1, 64] and the image width
+     * @param tilesY Tiles down, clamped to [1, 64] and the image height
+     * @param clipLimit Contrast limit, clamped to [0, 100]; 0 disables the limit
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyClahe(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                    int tilesX = 8, int tilesY = 8, double clipLimit = 2.0);
+
+    /**
+     * @brief Reduces the image to a palette of at most @p colors colors.
+     * 
+     * Picks the palette by median cut, optionally refined by k-means in Lab space, and
+     * replaces every pixel by its nearest palette color (see Quantizer). The result can
+     * be saved as an indexed PNG (EncodeOptions::pngPalette).
+     * 
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param colors Palette size, clamped to [2, 256]
+     * @param method How the palette is chosen
+     * @param dither Apply an ordered dither to hide banding in gradients
+     * 
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyQuantize(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested,
+                       int colors = 256, QuantizeMethod method = QuantizeMethod::KMeans, bool dither = false);
     
     /**
      * @brief Applies an infrared photography simulation effect.
@@ -346,6 +706,22 @@ public:
      */
     void applyPurpleFilter(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
 
+    /**
+     * @brief Evaluates a lazily built filter pipeline with progress and cancellation.
+     *
+     * The pipeline is compiled into fused banded passes (see FilterPipeline), so a
+     * chain of several filters costs roughly one pass over memory per fusion barrier
+     * instead of one full-frame round trip per filter.
+     *
+     * @param currentImage Reference to the image to process (modified in-place)
+     * @param preFilterImage Reference to store the original image state for cancellation
+     * @param cancelRequested Atomic flag to check for cancellation requests
+     * @param pipeline Pipeline describing the operations to run
+     *
+     * @note This is a long-running operation that can be cancelled.
+     */
+    void applyPipeline(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, const FilterPipeline& pipeline);
+
     // New filters with progress and cancellation
     void applyEmboss(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
     void applyDoubleVision(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested, int offset = 15);
@@ -354,20 +730,34 @@ public:
     void applyFishEye(Image& currentImage, Image& preFilterImage, std::atomic<bool>& cancelRequested);
 
 private:
-    QProgressBar* progressBar;  ///< Pointer to Qt progress bar for progress tracking
-    QStatusBar* statusBar;      ///< Pointer to Qt status bar for status updates
+    FilterObserver* observer;  ///< Receiver of progress and status updates (not owned)
+    Arithmetic arithmeticMode = Arithmetic::FixedPoint; ///< See setArithmetic()
+    WorkingSpace workingSpaceMode = WorkingSpace::Srgb; ///< See setWorkingSpace()
+    
+    /**
+     * @brief Shows the progress display with range [0, total].
+     */
+    void beginProgress(int total);
     
     /**
-     * @brief Updates the progress bar with current progress.
+     * @brief Reports current progress to the observer.
      * 
      * @param value Current progress value (0 to total)
      * @param total Maximum progress value
-     * @param updateInterval Number of operations between UI updates (default: 50)
      * 
-     * @note This method is thread-safe and can be called from any thread.
-     * @see QApplication::processEvents() for UI responsiveness
+     * @note Must be called on the thread that invoked the filter.
+     */
+    void updateProgress(int value, int total);
+    
+    /**
+     * @brief Hides the progress display.
+     */
+    void endProgress();
+    
+    /**
+     * @brief Forwards a status message to the observer.
      */
-    void updateProgress(int value, int total, int updateInterval = 50);
+    void showStatus(const std::string& message);
     
     /**
      * @brief Checks for cancellation and restores previous image state if cancelled.
@@ -380,7 +770,38 @@ private:
      * @note This method should be called periodically during long-running operations.
      * @see std::atomic for thread-safe cancellation
      */
-    void checkCancellation(std::atomic<bool>& cancelRequested, Image& currentImage, Image& preFilterImage, const QString& filterName);
+    void checkCancellation(std::atomic<bool>& cancelRequested, Image& currentImage, Image& preFilterImage, const std::string& filterName);
+
+    /**
+     * @brief Runs @p body over row bands [y0, y1) of [0, rows) on the shared thread pool.
+     *
+     * @param rows Number of rows to process
+     * @param width Row width in pixels, used to size the bands
+     * @param body Function processing one band; called concurrently for disjoint bands
+     */
+    void parallelRows(int rows, int width, const std::function<void(int y0, int y1)>& body);
+
+    /**
+     * @brief Runs @p body over row bands with progress tracking and cancellation support.
+     *
+     * Progress is aggregated across workers and reported on the calling thread through
+     * updateProgress(), so beginProgress() should be called with @p rows beforehand.
+     *
+     * @param rows Number of rows to process
+     * @param width Row width in pixels, used to size the bands
+     * @param cancelRequested Atomic flag; bands that have not started are skipped once set
+     * @param body Function processing one band; called concurrently for disjoint bands
+     * @return false if the operation was cancelled before every band ran
+     */
+    bool parallelRows(int rows, int width, std::atomic<bool>& cancelRequested, const std::function<void(int y0, int y1)>& body);
+
+    /**
+     * @brief Like the cancellable parallelRows(), with bands of @p bandRows rows.
+     *
+     * For filters whose bands recompute a halo, where the default band height would
+     * make the halo dominate.
+     */
+    bool parallelBands(int rows, int bandRows, std::atomic<bool>& cancelRequested, const std::function<void(int y0, int y1)>& body);
 };
 
 #endif // IMAGEFILTERS_H
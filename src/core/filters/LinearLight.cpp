@@ -0,0 +1,53 @@
+/**
+ * @file LinearLight.cpp
+ * @brief Implementation of the sRGB <-> linear light lookup tables.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "LinearLight.h"
+#include <array>
+#include <cmath>
+
+namespace {
+
+/// IEC 61966-2-1 transfer functions on [0, 1]
+double srgbToLinear(double v)
+{
+    return v <= 0.04045 ? v / 12.92 : std::pow((v + 0.055) / 1.055, 2.4);
+}
+
+double linearToSrgb(double v)
+{
+    return v <= 0.0031308 ? v * 12.92 : 1.055 * std::pow(v, 1.0 / 2.4) - 0.055;
+}
+
+} // namespace
+
+const std::uint16_t* LinearLight::decodeTable()
+{
+    static const std::array<std::uint16_t, 256> table = [] {
+        std::array<std::uint16_t, 256> entries{};
+        for (int v = 0; v < 256; ++v) {
+            entries[v] = static_cast<std::uint16_t>(std::lround(srgbToLinear(v / 255.0) * Max));
+        }
+        return entries;
+    }();
+    return table.data();
+}
+
+const unsigned char* LinearLight::encodeTable()
+{
+    static const std::array<unsigned char, Max + 1> table = [] {
+        std::array<unsigned char, Max + 1> entries{};
+        for (int v = 0; v <= Max; ++v) {
+            entries[v] = static_cast<unsigned char>(std::lround(linearToSrgb(static_cast<double>(v) / Max) * 255.0));
+        }
+        return entries;
+    }();
+    return table.data();
+}
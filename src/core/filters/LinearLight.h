@@ -0,0 +1,65 @@
+/**
+ * @file LinearLight.h
+ * @brief Lookup tables between sRGB bytes and linear light.
+ *
+ * This file contains the declaration of the LinearLight tables used by the filters
+ * that honor WorkingSpace::Linear. Image bytes are sRGB encoded: the level stored is
+ * roughly the square root of the light it stands for, so averaging stored levels
+ * (blending, blurring, resizing) gives results darker than the light being mixed,
+ * which shows as dark fringes along high-contrast edges. Those filters convert to
+ * linear light on the fly, do their arithmetic there and convert back.
+ *
+ * @details Linear values are 12-bit integers (0 to LinearLight::Max). Decoding is a
+ * 256-entry table and encoding a 4096-entry table, both built once on first use, so a
+ * conversion costs one load and filters convert inside their own passes, pixel by pixel
+ * or row by row, without a frame-sized linear copy. Twelve bits keep every sRGB level
+ * apart, even in the shadows, so decoding then encoding returns every byte unchanged.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef LINEARLIGHT_H
+#define LINEARLIGHT_H
+
+#include <cstdint>
+
+/**
+ * @class LinearLight
+ * @brief Static sRGB <-> 12-bit linear light conversions.
+ *
+ * @example
+ * @code
+ * const std::uint16_t* decode = LinearLight::decodeTable();
+ * const int mixed = (decode[a] + decode[b] + 1) / 2; // average of the light
+ * out = LinearLight::encode(mixed);
+ * @endcode
+ */
+class LinearLight
+{
+public:
+    /// Bits of a linear value
+    static constexpr int Bits = 12;
+    /// Linear value of sRGB white
+    static constexpr int Max = (1 << Bits) - 1;
+
+    /** @brief Table of 256 linear values, indexed by sRGB byte. */
+    static const std::uint16_t* decodeTable();
+
+    /** @brief Table of Max + 1 sRGB bytes, indexed by linear value. */
+    static const unsigned char* encodeTable();
+
+    /** @brief Linear value of an sRGB byte. */
+    static int decode(unsigned char value) { return decodeTable()[value]; }
+
+    /** @brief sRGB byte of a linear value; values outside [0, Max] are clamped. */
+    static unsigned char encode(int value)
+    {
+        return encodeTable()[value < 0 ? 0 : value > Max ? Max : value];
+    }
+};
+
+#endif // LINEARLIGHT_H
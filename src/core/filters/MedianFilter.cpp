@@ -0,0 +1,258 @@
+/**
+ * @file MedianFilter.cpp
+ * @brief Implementation of the two-level column-histogram median filter.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "MedianFilter.h"
+#include "image/Image_Class.h"
+#include "parallel/ThreadPool.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr int Bins = 256;
+constexpr int Coarse = 16;   ///< Coarse bins, each covering 16 fine bins
+
+// 16-bin group kernels. SSE2 is part of every x86-64 target; other targets use scalar
+// loops with identical results.
+
+/// a += b - c over one 16-bin group (wrapping 16-bit arithmetic; results stay in range)
+inline void slideBins(std::uint16_t* a, const std::uint16_t* b, const std::uint16_t* c)
+{
+#if defined(__SSE2__)
+    for (int i = 0; i < 16; i += 8) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        const __m128i vc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), _mm_add_epi16(va, _mm_sub_epi16(vb, vc)));
+    }
+#else
+    for (int i = 0; i < 16; ++i) {
+        a[i] = static_cast<std::uint16_t>(a[i] + b[i] - c[i]);
+    }
+#endif
+}
+
+/// a += b over one 16-bin group
+inline void addBins(std::uint16_t* a, const std::uint16_t* b)
+{
+#if defined(__SSE2__)
+    for (int i = 0; i < 16; i += 8) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), _mm_add_epi16(va, vb));
+    }
+#else
+    for (int i = 0; i < 16; ++i) {
+        a[i] = static_cast<std::uint16_t>(a[i] + b[i]);
+    }
+#endif
+}
+
+/**
+ * @brief Finds the bin of a 16-bin group containing zero-based rank @p rank.
+ * @param below Count below the group on entry, count below the returned bin on exit
+ *
+ * Branch-free: on noisy images the bin changes unpredictably from pixel to pixel.
+ */
+inline int findBin(const std::uint16_t* bins, int rank, int& below)
+{
+#if defined(__SSE2__)
+    // Inclusive prefix sums of both halves (window counts stay below 32768), carry the
+    // low half's total into the high half, then find the first prefix above the rank
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bins));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bins + 8));
+    lo = _mm_add_epi16(lo, _mm_slli_si128(lo, 2));
+    hi = _mm_add_epi16(hi, _mm_slli_si128(hi, 2));
+    lo = _mm_add_epi16(lo, _mm_slli_si128(lo, 4));
+    hi = _mm_add_epi16(hi, _mm_slli_si128(hi, 4));
+    lo = _mm_add_epi16(lo, _mm_slli_si128(lo, 8));
+    hi = _mm_add_epi16(hi, _mm_slli_si128(hi, 8));
+    hi = _mm_add_epi16(hi, _mm_shuffle_epi32(_mm_shufflehi_epi16(lo, 0xFF), 0xFF));
+    const __m128i limit = _mm_set1_epi16(static_cast<short>(rank - below));
+    const int above = _mm_movemask_epi8(_mm_packs_epi16(_mm_cmpgt_epi16(lo, limit), _mm_cmpgt_epi16(hi, limit)));
+    const int bin = std::countr_zero(static_cast<unsigned>(above) | 0x10000u);
+    alignas(16) std::uint16_t prefix[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(prefix), lo);
+    _mm_store_si128(reinterpret_cast<__m128i*>(prefix + 8), hi);
+    if (bin > 0) below += prefix[bin - 1];
+    return bin;
+#else
+    int bin = 0;
+    int prefix = below;
+    for (int i = 0; i < 16; ++i) {
+        prefix += bins[i];
+        const int before = prefix <= rank;
+        bin += before;
+        below += before ? bins[i] : 0;
+    }
+    return bin;
+#endif
+}
+
+/**
+ * @brief Column histograms of one tile: for every column and channel, 256 fine and 16
+ *        coarse counts of the pixels in the current vertical window.
+ */
+class ColumnHistograms
+{
+public:
+    ColumnHistograms(const Image& src, int first, int last)
+        : src(src), first(first), columns(last - first),
+          fine(static_cast<std::size_t>(columns) * 3 * Bins),
+          coarse(static_cast<std::size_t>(columns) * 3 * Coarse)
+    {
+    }
+
+    /// Adds (@p delta = 1) or removes (@p delta = -1) image row @p y
+    void update(int y, int delta)
+    {
+        const unsigned char* row = src.imageData + (static_cast<std::size_t>(y) * src.width + first) * 3;
+        for (int c = 0; c < columns * 3; ++c) {
+            const int v = row[c];
+            fine[static_cast<std::size_t>(c) * Bins + v] += static_cast<std::uint16_t>(delta);
+            coarse[static_cast<std::size_t>(c) * Coarse + (v >> 4)] += static_cast<std::uint16_t>(delta);
+        }
+    }
+
+    /// Fine counts of channel @p ch of image column @p x
+    const std::uint16_t* fineOf(int x, int ch) const
+    {
+        return fine.data() + (static_cast<std::size_t>(x - first) * 3 + ch) * Bins;
+    }
+
+    /// Coarse counts of channel @p ch of image column @p x
+    const std::uint16_t* coarseOf(int x, int ch) const
+    {
+        return coarse.data() + (static_cast<std::size_t>(x - first) * 3 + ch) * Coarse;
+    }
+
+private:
+    const Image& src;
+    int first;
+    int columns;
+    std::vector<std::uint16_t> fine;
+    std::vector<std::uint16_t> coarse;
+};
+
+/**
+ * @brief Window histogram of one channel sliding along a row.
+ *
+ * Coarse counts are kept current at every step; each fine bucket remembers the column
+ * it was last brought up to date for and catches up only when the median falls in it.
+ */
+struct KernelHistogram {
+    std::uint16_t coarse[Coarse];
+    std::uint16_t fine[Bins];
+    int updatedAt[Coarse];
+};
+
+} // namespace
+
+int MedianFilter::tileHeight(int radius, int width, int height)
+{
+    // Allocating and building a tile's column histograms costs a few hundred rows of
+    // sliding, so tiles are tall; narrow images are cut into enough bands to keep four
+    // tiles per thread
+    const int window = 2 * radius + 1;
+    const int strips = (width + TileWidth - 1) / TileWidth;
+    const int bands = std::max(1, 4 * ThreadPool::instance().concurrency() / std::max(1, strips));
+    const int balanced = std::max(window, (height + bands - 1) / bands);
+    return std::max(1, std::min({height, balanced, std::max(TileWidth, 4 * window)}));
+}
+
+void MedianFilter::medianTile(const Image& src, Image& dst, int radius, int x0, int y0, int x1, int y1)
+{
+    if (radius < 1 || radius > MaxRadius) {
+        throw std::invalid_argument("Median radius must be between 1 and " + std::to_string(MaxRadius));
+    }
+    const int width = src.width;
+    const int height = src.height;
+    x0 = std::max(0, x0);
+    y0 = std::max(0, y0);
+    x1 = std::min(width, x1);
+    y1 = std::min(height, y1);
+    if (x1 <= x0 || y1 <= y0) return;
+
+    const int window = 2 * radius + 1;
+    const int rank = window * window / 2;    // zero-based index of the median
+    const auto clampX = [width](int x) { return std::clamp(x, 0, width - 1); };
+    const auto clampY = [height](int y) { return std::clamp(y, 0, height - 1); };
+
+    // Window of (x0, y0), with the edges replicated
+    ColumnHistograms columns(src, std::max(0, x0 - radius), std::min(width, x1 + radius));
+    for (int y = y0 - radius; y <= y0 + radius; ++y) {
+        columns.update(clampY(y), 1);
+    }
+
+    KernelHistogram kernels[3];
+    for (int y = y0; y < y1; ++y) {
+        if (y > y0) {
+            const int leaving = clampY(y - radius - 1);
+            const int entering = clampY(y + radius);
+            if (leaving != entering) {
+                columns.update(leaving, -1);
+                columns.update(entering, 1);
+            }
+        }
+
+        for (int ch = 0; ch < 3; ++ch) {
+            KernelHistogram& k = kernels[ch];
+            std::fill(std::begin(k.coarse), std::end(k.coarse), std::uint16_t(0));
+            std::fill(std::begin(k.updatedAt), std::end(k.updatedAt), x0 - window - 1);
+            for (int x = x0 - radius; x <= x0 + radius; ++x) {
+                addBins(k.coarse, columns.coarseOf(clampX(x), ch));
+            }
+        }
+
+        unsigned char* out = dst.imageData + static_cast<std::size_t>(y) * width * 3;
+        for (int x = x0; x < x1; ++x) {
+            const int entering = clampX(x + radius);
+            const int leaving = clampX(x - radius - 1);
+            for (int ch = 0; ch < 3; ++ch) {
+                KernelHistogram& k = kernels[ch];
+                if (x > x0) {
+                    slideBins(k.coarse, columns.coarseOf(entering, ch), columns.coarseOf(leaving, ch));
+                }
+
+                // Coarse bucket holding the median
+                int below = 0;
+                const int bucket = findBin(k.coarse, rank, below);
+
+                // Bring that bucket's fine counts up to column x: slide when it is a few
+                // columns behind, rebuild from the window otherwise
+                std::uint16_t* fine = k.fine + bucket * 16;
+                const int offset = bucket * 16;
+                if (x - k.updatedAt[bucket] > radius) {
+                    std::fill(fine, fine + 16, std::uint16_t(0));
+                    for (int c = x - radius; c <= x + radius; ++c) {
+                        addBins(fine, columns.fineOf(clampX(c), ch) + offset);
+                    }
+                } else {
+                    for (int c = k.updatedAt[bucket] + 1; c <= x; ++c) {
+                        slideBins(fine, columns.fineOf(clampX(c + radius), ch) + offset,
+                                  columns.fineOf(clampX(c - radius - 1), ch) + offset);
+                    }
+                }
+                k.updatedAt[bucket] = x;
+
+                out[x * 3 + ch] = static_cast<unsigned char>(offset + findBin(fine, rank, below));
+            }
+        }
+    }
+}
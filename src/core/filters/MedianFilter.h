@@ -0,0 +1,71 @@
+/**
+ * @file MedianFilter.h
+ * @brief Constant-time (per pixel) median filter built on column histograms.
+ *
+ * This file contains the declaration of the MedianFilter helper used by
+ * ImageFilters::applyMedian(). Every channel is filtered independently: the output
+ * value is the median of the (2r + 1) x (2r + 1) window of that channel, with the
+ * image edges replicated outward, which removes salt-and-pepper noise while keeping
+ * edges sharp.
+ *
+ * @details The algorithm is Perreault and Hebert's: every column keeps a histogram of
+ * the 2r + 1 pixels centred on the current row, updated with one insertion and one
+ * removal per row, and the window histogram slides right by adding one column histogram
+ * and subtracting another. Histograms are two-level (16 coarse bins of 16 fine bins), so
+ * a step touches the 16 coarse counts and, lazily, the single fine bucket holding the
+ * median, eight counts at a time with SSE2. The cost per pixel therefore does not
+ * depend on the radius.
+ *
+ * Work is expressed per rectangular tile. A tile needs column histograms only for its
+ * own columns plus a radius on each side, which keeps them in cache, and it builds them
+ * from the 2r + 1 rows around its first row, so tiles run independently on any thread.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef MEDIANFILTER_H
+#define MEDIANFILTER_H
+
+class Image;
+
+/**
+ * @class MedianFilter
+ * @brief Static helpers computing per-channel medians by tile.
+ */
+class MedianFilter
+{
+public:
+    /// Largest supported radius (window counts must fit 16-bit histogram bins)
+    static constexpr int MaxRadius = 50;
+
+    /// Width of the column strips images are split into; keeps a strip's histograms in L2
+    static constexpr int TileWidth = 256;
+
+    /**
+     * @brief Picks a tile height that amortizes building the column histograms.
+     * @param radius Window radius
+     * @param width Image width
+     * @param height Image height
+     */
+    static int tileHeight(int radius, int width, int height);
+
+    /**
+     * @brief Writes the median of columns [x0, x1) and rows [y0, y1) of @p src into @p dst.
+     * @param src Source image
+     * @param dst Destination image of the same size (must not alias @p src)
+     * @param radius Window radius in [1, MaxRadius]; the window is 2 * radius + 1 pixels
+     *        wide and high
+     * @param x0 First column
+     * @param y0 First row
+     * @param x1 One past the last column
+     * @param y1 One past the last row
+     * @throws std::invalid_argument if @p radius is out of range
+     */
+    static void medianTile(const Image& src, Image& dst, int radius, int x0, int y0, int x1, int y1);
+};
+
+#endif // MEDIANFILTER_H
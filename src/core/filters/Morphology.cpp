@@ -0,0 +1,204 @@
+/**
+ * @file Morphology.cpp
+ * @brief Implementation of the van Herk/Gil-Werman erosion and dilation.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "Morphology.h"
+#include "image/Image_Class.h"
+#include "parallel/ThreadPool.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// Min and max on bytes; neutral is the value that never wins, used outside the image.
+// Each has a scalar form and, when available, SIMD forms with identical results.
+
+struct MinOp {
+    static constexpr unsigned char neutral = 255;
+    static unsigned char apply(unsigned char a, unsigned char b) { return a < b ? a : b; }
+#if defined(__AVX2__)
+    static __m256i apply(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+#endif
+#if defined(__SSE2__)
+    static __m128i apply(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+#endif
+};
+
+struct MaxOp {
+    static constexpr unsigned char neutral = 0;
+    static unsigned char apply(unsigned char a, unsigned char b) { return a > b ? a : b; }
+#if defined(__AVX2__)
+    static __m256i apply(__m256i a, __m256i b) { return _mm256_max_epu8(a, b); }
+#endif
+#if defined(__SSE2__)
+    static __m128i apply(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+#endif
+};
+
+/// out[i] = op(a[i], b[i]) for @p count bytes; @p out may be @p a or @p b
+template <class Op>
+void combineSpan(unsigned char* out, const unsigned char* a, const unsigned char* b, std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= count; i += 32) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), Op::apply(va, vb));
+    }
+#endif
+#if defined(__SSE2__)
+    for (; i + 16 <= count; i += 16) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), Op::apply(va, vb));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = Op::apply(a[i], b[i]);
+    }
+}
+
+/**
+ * @brief Horizontal run of @p length pixels over one RGB row.
+ *
+ * Output pixel x is op over input pixels [x - before, x - before + length).
+ * @p padded, @p forward and @p backward are scratch rows reused between calls.
+ */
+template <class Op>
+void horizontalRun(const unsigned char* in, unsigned char* out, int width, int length, int before,
+                   std::vector<unsigned char>& padded, std::vector<unsigned char>& forward,
+                   std::vector<unsigned char>& backward)
+{
+    const std::size_t rowBytes = static_cast<std::size_t>(width) * 3;
+    if (length == 1) {
+        std::memcpy(out, in, rowBytes);
+        return;
+    }
+    const int count = width + length - 1;
+    const std::size_t bytes = static_cast<std::size_t>(count) * 3;
+    padded.assign(bytes, Op::neutral);
+    std::memcpy(padded.data() + static_cast<std::size_t>(before) * 3, in, rowBytes);
+    forward.resize(bytes);
+    backward.resize(bytes);
+
+    const unsigned char* p = padded.data();
+    unsigned char* g = forward.data();
+    unsigned char* h = backward.data();
+    for (int start = 0; start < count; start += length) {
+        const int end = std::min(count, start + length);
+        // Running op from the left and from the right inside the block
+        for (int c = 0; c < 3; ++c) {
+            g[start * 3 + c] = p[start * 3 + c];
+            h[(end - 1) * 3 + c] = p[(end - 1) * 3 + c];
+        }
+        for (int i = (start + 1) * 3; i < end * 3; ++i) {
+            g[i] = Op::apply(g[i - 3], p[i]);
+        }
+        for (int i = (end - 1) * 3 - 1; i >= start * 3; --i) {
+            h[i] = Op::apply(h[i + 3], p[i]);
+        }
+    }
+    // Window [x, x + length) ends in the block after the one it starts in (or the same one)
+    combineSpan<Op>(out, h, g + static_cast<std::size_t>(length - 1) * 3, rowBytes);
+}
+
+/**
+ * @brief Op over the element for rows [rowBegin, rowEnd).
+ * @param mirrored Put the extra column and row of even sizes on the left and top
+ */
+template <class Op>
+void morphologyRows(const Image& src, Image& dst, int elementWidth, int elementHeight, bool mirrored,
+                    int rowBegin, int rowEnd)
+{
+    if (elementWidth < 1 || elementHeight < 1) {
+        throw std::invalid_argument("Structuring element must be at least 1x1");
+    }
+    const int width = src.width;
+    const int height = src.height;
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(height, rowEnd);
+    if (rowEnd <= rowBegin) return;
+
+    // The window covers (size - 1) / 2 pixels before and size / 2 after, or the mirror image
+    const int left = mirrored ? elementWidth / 2 : (elementWidth - 1) / 2;
+    const int above = mirrored ? elementHeight / 2 : (elementHeight - 1) / 2;
+
+    // Horizontal runs of the band and its halo; rows outside the image never win
+    const std::size_t rowBytes = static_cast<std::size_t>(width) * 3;
+    const int count = rowEnd - rowBegin + elementHeight - 1;
+    const int first = rowBegin - above;
+    std::vector<unsigned char> runs(static_cast<std::size_t>(count) * rowBytes);
+    std::vector<unsigned char> padded, forward, backward;
+    for (int i = 0; i < count; ++i) {
+        unsigned char* row = runs.data() + i * rowBytes;
+        const int y = first + i;
+        if (y < 0 || y >= height) {
+            std::memset(row, Op::neutral, rowBytes);
+        } else {
+            horizontalRun<Op>(src.imageData + y * rowBytes, row, width, elementWidth, left, padded, forward, backward);
+        }
+    }
+
+    if (elementHeight == 1) {
+        std::memcpy(dst.imageData + rowBegin * rowBytes, runs.data(), runs.size());
+        return;
+    }
+
+    // Vertical van Herk/Gil-Werman on whole rows: forward op into a second buffer, backward
+    // op in place, then one row-wide op per output row
+    std::vector<unsigned char> forwardRuns(runs.size());
+    unsigned char* h = runs.data();
+    unsigned char* g = forwardRuns.data();
+    for (int start = 0; start < count; start += elementHeight) {
+        const int end = std::min(count, start + elementHeight);
+        std::memcpy(g + start * rowBytes, h + start * rowBytes, rowBytes);
+        for (int i = start + 1; i < end; ++i) {
+            combineSpan<Op>(g + i * rowBytes, g + (i - 1) * rowBytes, h + i * rowBytes, rowBytes);
+        }
+        for (int i = end - 2; i >= start; --i) {
+            combineSpan<Op>(h + i * rowBytes, h + (i + 1) * rowBytes, h + i * rowBytes, rowBytes);
+        }
+    }
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const int i = y - rowBegin;
+        combineSpan<Op>(dst.imageData + y * rowBytes, h + i * rowBytes, g + (i + elementHeight - 1) * rowBytes, rowBytes);
+    }
+}
+
+} // namespace
+
+int Morphology::bandHeight(int elementHeight, int width, int height)
+{
+    // Bands of at least four element heights, so recomputed halo rows stay below a
+    // quarter of the work, but still four bands per thread when the image allows
+    const int bands = 4 * ThreadPool::instance().concurrency();
+    const int balanced = std::max(elementHeight, (height + bands - 1) / bands);
+    const int rows = std::max(ThreadPool::rowGrain(width, height), 4 * elementHeight);
+    return std::max(1, std::min({height, balanced, rows}));
+}
+
+void Morphology::erodeRows(const Image& src, Image& dst, int elementWidth, int elementHeight, int rowBegin, int rowEnd)
+{
+    morphologyRows<MinOp>(src, dst, elementWidth, elementHeight, false, rowBegin, rowEnd);
+}
+
+void Morphology::dilateRows(const Image& src, Image& dst, int elementWidth, int elementHeight, int rowBegin, int rowEnd)
+{
+    morphologyRows<MaxOp>(src, dst, elementWidth, elementHeight, true, rowBegin, rowEnd);
+}
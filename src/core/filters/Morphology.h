@@ -0,0 +1,73 @@
+/**
+ * @file Morphology.h
+ * @brief Erosion and dilation by rectangles with the van Herk/Gil-Werman algorithm.
+ *
+ * This file contains the declaration of the Morphology helper used by
+ * ImageFilters::applyMorphology(). Erosion replaces every channel value by the minimum
+ * over a w x h rectangle around the pixel, dilation by the maximum; opening, closing
+ * and the morphological gradient are compositions of the two. Each channel is treated
+ * as a grayscale image, so the same code cleans black-and-white documents and filters
+ * grayscale or color photos.
+ *
+ * @details A rectangle is separable into a horizontal and a vertical run. A run of
+ * length k is computed with van Herk/Gil-Werman: the line is cut into blocks of k, a
+ * running minimum (or maximum) is taken forwards and backwards inside every block, and
+ * each window, which spans at most two blocks, is the minimum of one backward and one
+ * forward value. That is three comparisons per value whatever k is. The vertical run
+ * works on whole rows, so every comparison is a row-wide SIMD operation (SSE2, or AVX2
+ * when enabled); the horizontal run uses SIMD for its final comparison.
+ *
+ * The rectangle is anchored at its center (for even sizes, the extra column or row is
+ * on the right or bottom for erosion and mirrored for dilation, so opening and closing
+ * are exact). Pixels outside the image are ignored.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef MORPHOLOGY_H
+#define MORPHOLOGY_H
+
+class Image;
+
+/**
+ * @class Morphology
+ * @brief Static helpers computing erosions and dilations by row band.
+ *
+ * Each band recomputes the horizontal runs of the element-height rows around it (its
+ * halo), so bands are independent and may run on different threads.
+ */
+class Morphology
+{
+public:
+    /**
+     * @brief Picks a band height that keeps the halo a small fraction of each band.
+     * @param elementHeight Height of the structuring element
+     * @param width Image width
+     * @param height Image height
+     */
+    static int bandHeight(int elementHeight, int width, int height);
+
+    /**
+     * @brief Writes the erosion of rows [rowBegin, rowEnd) of @p src into @p dst.
+     * @param src Source image
+     * @param dst Destination image of the same size (must not alias @p src)
+     * @param elementWidth Width of the rectangle, at least 1
+     * @param elementHeight Height of the rectangle, at least 1
+     * @param rowBegin First output row
+     * @param rowEnd One past the last output row
+     * @throws std::invalid_argument if the element is empty
+     */
+    static void erodeRows(const Image& src, Image& dst, int elementWidth, int elementHeight, int rowBegin, int rowEnd);
+
+    /**
+     * @brief Writes the dilation of rows [rowBegin, rowEnd) of @p src into @p dst.
+     * @see erodeRows() for the parameters
+     */
+    static void dilateRows(const Image& src, Image& dst, int elementWidth, int elementHeight, int rowBegin, int rowEnd);
+};
+
+#endif // MORPHOLOGY_H
@@ -0,0 +1,132 @@
+/**
+ * @file PointOp.h
+ * @brief Lookup-table based per-channel point operations with composition support.
+ *
+ * This file contains the declaration of the PointOp class, which represents any filter
+ * whose output channel value depends only on the input value of the same channel
+ * (invert, purple tint, sunlight boost, darken/lighten). Each operation is compiled
+ * into a 256-entry lookup table per channel, and consecutive operations can be
+ * composed into a single table so that a whole chain runs in one pass over memory.
+ *
+ * @details The PointOp class provides:
+ * - Factory functions for every built-in point filter
+ * - Composition of operations into a single lookup table
+ * - Row-wise application over raw image memory without temporary images
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef POINTOP_H
+#define POINTOP_H
+
+class Image;
+#include "FilterTypes.h"
+#include <vector>
+
+/**
+ * @class PointOp
+ * @brief A per-channel byte mapping compiled to three 256-entry lookup tables.
+ *
+ * A PointOp maps every channel value v of every pixel to lut[c][v]. Because the
+ * mapping is independent of the pixel position, any sequence of point operations
+ * collapses into a single PointOp via then() or compose().
+ *
+ * @example
+ * @code
+ * PointOp chain = PointOp::darkAndLight(false, 30)
+ *                     .then(PointOp::purple())
+ *                     .then(PointOp::invert());
+ * chain.apply(image); // one pass over the pixels
+ * @endcode
+ */
+class PointOp
+{
+public:
+    /**
+     * @brief Constructs the identity operation.
+     */
+    PointOp();
+
+    /** @brief Identity mapping (v -> v). */
+    static PointOp identity();
+    /** @brief Color inversion (v -> 255 - v). */
+    static PointOp invert();
+    /** @brief Purple tint (R * 1.3, G * 0.5, B * 1.3, clamped). */
+    static PointOp purple();
+    /** @brief Sunlight enhancement (R * 1.4, G * 1.4, clamped; B unchanged). */
+    static PointOp sunlight();
+    /**
+     * @brief Fixed darken/lighten used by the legacy Dark & Light filter.
+     * @param darken true divides values by 3, false doubles them (clamped to 255)
+     * @param space Linear scales the light instead of the sRGB levels, like an exposure change
+     */
+    static PointOp darkAndLight(bool darken, WorkingSpace space = WorkingSpace::Srgb);
+    /**
+     * @brief Percentage darken/lighten used by the Dark & Light slider.
+     * @param darken true to darken, false to lighten
+     * @param percent Percentage in [0, 100]; values outside are clamped
+     * @param space Linear scales the light instead of the sRGB levels, like an exposure change
+     */
+    static PointOp darkAndLight(bool darken, int percent, WorkingSpace space = WorkingSpace::Srgb);
+    /**
+     * @brief Builds an operation from explicit per-channel tables.
+     * @param red Table for channel 0
+     * @param green Table for channel 1
+     * @param blue Table for channel 2
+     */
+    static PointOp fromTables(const unsigned char red[256], const unsigned char green[256], const unsigned char blue[256]);
+
+    /**
+     * @brief Returns the operation equivalent to applying this one followed by @p next.
+     * @param next Operation applied to the output of this one
+     */
+    PointOp then(const PointOp& next) const;
+
+    /**
+     * @brief Composes a sequence of operations (applied front to back) into one.
+     * @param ops Operations in application order; an empty list yields identity
+     */
+    static PointOp compose(const std::vector<PointOp>& ops);
+
+    /**
+     * @brief Maps a single channel value.
+     * @param channel Channel index (0 = R, 1 = G, 2 = B)
+     * @param value Input value
+     */
+    unsigned char map(int channel, unsigned char value) const { return lut[channel][value]; }
+
+    /**
+     * @brief Returns the lookup table of a channel.
+     * @param channel Channel index (0 = R, 1 = G, 2 = B)
+     */
+    const unsigned char* table(int channel) const { return lut[channel]; }
+
+    /** @brief True if the operation leaves every value unchanged. */
+    bool isIdentity() const;
+
+    /**
+     * @brief Applies the operation to a run of interleaved RGB pixels in place.
+     * @param data Pointer to the first byte of the run
+     * @param pixelCount Number of RGB pixels in the run
+     */
+    void applyToPixels(unsigned char* data, int pixelCount) const;
+
+    /**
+     * @brief Applies the operation in place to rows [rowBegin, rowEnd) of an image.
+     */
+    void applyRows(Image& image, int rowBegin, int rowEnd) const;
+
+    /**
+     * @brief Applies the operation in place to the whole image in a single pass.
+     */
+    void apply(Image& image) const;
+
+private:
+    unsigned char lut[3][256]; ///< Per-channel lookup tables
+};
+
+#endif // POINTOP_H
@@ -0,0 +1,416 @@
+/**
+ * @file Quantizer.cpp
+ * @brief Implementation of median cut, Lab k-means and the palette lookup cube.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "Quantizer.h"
+#include "Dither.h"
+#include "image/Image_Class.h"
+#include "parallel/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr int HistogramBits = 5;  ///< Bits per channel of the sample histogram
+constexpr int CubeBits = 6;       ///< Bits per channel of the lookup cube
+constexpr int KMeansIterations = 8;
+constexpr int SampleChunk = 1024; ///< Samples per k-means task; fixed so sums do not depend on threads
+
+struct Lab {
+    float l;
+    float a;
+    float b;
+};
+
+/// A histogram cell: mean color and pixel count
+struct Sample {
+    float rgb[3];
+    std::uint64_t weight;
+    Lab lab;
+};
+
+float toLinear(float value)
+{
+    const float c = value / 255.0f;
+    return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+float toGamma(float c)
+{
+    c = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+    return std::clamp(c * 255.0f, 0.0f, 255.0f);
+}
+
+float labCurve(float t)
+{
+    constexpr float delta = 6.0f / 29.0f;
+    return t > delta * delta * delta ? std::cbrt(t) : t / (3.0f * delta * delta) + 4.0f / 29.0f;
+}
+
+float labCurveInverse(float f)
+{
+    constexpr float delta = 6.0f / 29.0f;
+    return f > delta ? f * f * f : 3.0f * delta * delta * (f - 4.0f / 29.0f);
+}
+
+/// sRGB (0..255 per channel) to CIE Lab under D65
+Lab toLab(float red, float green, float blue)
+{
+    const float r = toLinear(red);
+    const float g = toLinear(green);
+    const float b = toLinear(blue);
+    const float x = labCurve((0.4124564f * r + 0.3575761f * g + 0.1804375f * b) / 0.95047f);
+    const float y = labCurve(0.2126729f * r + 0.7151522f * g + 0.0721750f * b);
+    const float z = labCurve((0.0193339f * r + 0.1191920f * g + 0.9503041f * b) / 1.08883f);
+    return {116.0f * y - 16.0f, 500.0f * (x - y), 200.0f * (y - z)};
+}
+
+RgbColor toRgb(const Lab& lab)
+{
+    const float fy = (lab.l + 16.0f) / 116.0f;
+    const float x = 0.95047f * labCurveInverse(fy + lab.a / 500.0f);
+    const float y = labCurveInverse(fy);
+    const float z = 1.08883f * labCurveInverse(fy - lab.b / 200.0f);
+    RgbColor color;
+    color.r = static_cast<unsigned char>(std::lround(toGamma(3.2404542f * x - 1.5371385f * y - 0.4985314f * z)));
+    color.g = static_cast<unsigned char>(std::lround(toGamma(-0.9692660f * x + 1.8760108f * y + 0.0415560f * z)));
+    color.b = static_cast<unsigned char>(std::lround(toGamma(0.0556434f * x - 0.2040259f * y + 1.0572252f * z)));
+    return color;
+}
+
+float distance2(const Lab& p, const Lab& q)
+{
+    const float dl = p.l - q.l;
+    const float da = p.a - q.a;
+    const float db = p.b - q.b;
+    return dl * dl + da * da + db * db;
+}
+
+/**
+ * @brief Nearest-color search over a palette sorted by lightness.
+ *
+ * The search starts at the entries of closest lightness and walks outwards on both
+ * sides, stopping a side once the lightness difference alone exceeds the best distance.
+ */
+class PaletteSearch
+{
+public:
+    explicit PaletteSearch(const std::vector<Lab>& palette)
+    {
+        order.resize(palette.size());
+        for (std::size_t i = 0; i < order.size(); ++i) order[i] = static_cast<int>(i);
+        std::sort(order.begin(), order.end(), [&](int p, int q) { return palette[p].l < palette[q].l; });
+        for (int i : order) entries.push_back(palette[i]);
+    }
+
+    int nearest(const Lab& color) const
+    {
+        const int count = static_cast<int>(entries.size());
+        int up = static_cast<int>(std::lower_bound(entries.begin(), entries.end(), color.l,
+                                                   [](const Lab& e, float l) { return e.l < l; }) - entries.begin());
+        int down = up - 1;
+        int best = 0;
+        float bestDistance = std::numeric_limits<float>::max();
+        while (up < count || down >= 0) {
+            if (up < count) {
+                const float dl = entries[up].l - color.l;
+                if (dl * dl >= bestDistance) {
+                    up = count;
+                } else {
+                    const float d = distance2(entries[up], color);
+                    if (d < bestDistance) { bestDistance = d; best = up; }
+                    ++up;
+                }
+            }
+            if (down >= 0) {
+                const float dl = color.l - entries[down].l;
+                if (dl * dl >= bestDistance) {
+                    down = -1;
+                } else {
+                    const float d = distance2(entries[down], color);
+                    if (d < bestDistance) { bestDistance = d; best = down; }
+                    --down;
+                }
+            }
+        }
+        return order[best];
+    }
+
+private:
+    std::vector<int> order;  ///< Palette index of each sorted entry
+    std::vector<Lab> entries;
+};
+
+/// Samples [begin, end) of the median cut
+struct Box {
+    int begin;
+    int end;
+    int axis;     ///< Channel of largest spread
+    double error; ///< Weighted squared deviation from the mean, 0 if the box cannot split
+};
+
+Box measureBox(const std::vector<Sample>& samples, int begin, int end)
+{
+    double weight = 0.0;
+    double sum[3] = {};
+    double squares[3] = {};
+    for (int i = begin; i < end; ++i) {
+        const double w = static_cast<double>(samples[i].weight);
+        weight += w;
+        for (int c = 0; c < 3; ++c) {
+            sum[c] += w * samples[i].rgb[c];
+            squares[c] += w * samples[i].rgb[c] * samples[i].rgb[c];
+        }
+    }
+    Box box{begin, end, 0, 0.0};
+    double widest = -1.0;
+    for (int c = 0; c < 3; ++c) {
+        const double deviation = squares[c] - sum[c] * sum[c] / weight;
+        box.error += deviation;
+        if (deviation > widest) {
+            widest = deviation;
+            box.axis = c;
+        }
+    }
+    if (end - begin < 2) box.error = 0.0;
+    return box;
+}
+
+/// Splits the samples into at most @p count boxes and returns their weighted mean colors
+std::vector<Lab> medianCut(std::vector<Sample>& samples, int count)
+{
+    std::vector<Box> boxes{measureBox(samples, 0, static_cast<int>(samples.size()))};
+    while (static_cast<int>(boxes.size()) < count) {
+        auto widest = std::max_element(boxes.begin(), boxes.end(),
+                                       [](const Box& p, const Box& q) { return p.error < q.error; });
+        if (widest->error <= 0.0) break;
+        const Box box = *widest;
+        const int axis = box.axis;
+        std::sort(samples.begin() + box.begin, samples.begin() + box.end,
+                  [axis](const Sample& p, const Sample& q) { return p.rgb[axis] < q.rgb[axis]; });
+        // Split at the weighted median, keeping at least one sample on each side
+        double total = 0.0;
+        for (int i = box.begin; i < box.end; ++i) total += static_cast<double>(samples[i].weight);
+        double below = 0.0;
+        int split = box.begin + 1;
+        for (int i = box.begin; i < box.end - 1; ++i) {
+            below += static_cast<double>(samples[i].weight);
+            split = i + 1;
+            if (below * 2.0 >= total) break;
+        }
+        *widest = measureBox(samples, box.begin, split);
+        boxes.push_back(measureBox(samples, split, box.end));
+    }
+
+    std::vector<Lab> palette;
+    for (const Box& box : boxes) {
+        double weight = 0.0;
+        double sum[3] = {};
+        for (int i = box.begin; i < box.end; ++i) {
+            const double w = static_cast<double>(samples[i].weight);
+            weight += w;
+            for (int c = 0; c < 3; ++c) sum[c] += w * samples[i].rgb[c];
+        }
+        palette.push_back(toLab(static_cast<float>(sum[0] / weight), static_cast<float>(sum[1] / weight),
+                                static_cast<float>(sum[2] / weight)));
+    }
+    return palette;
+}
+
+/// Weighted Lloyd iterations in Lab, starting from @p palette
+void refineKMeans(const std::vector<Sample>& samples, std::vector<Lab>& palette)
+{
+    struct Sum {
+        double weight = 0.0;
+        double l = 0.0;
+        double a = 0.0;
+        double b = 0.0;
+    };
+    const int count = static_cast<int>(samples.size());
+    const int chunks = (count + SampleChunk - 1) / SampleChunk;
+    const std::size_t k = palette.size();
+    std::vector<int> assignment(samples.size(), -1);
+    std::vector<Sum> sums(static_cast<std::size_t>(chunks) * k);
+
+    for (int iteration = 0; iteration < KMeansIterations; ++iteration) {
+        // Assignment step: every chunk sums its samples per cluster on its own
+        const PaletteSearch search(palette);
+        std::vector<char> changed(chunks, 0);
+        std::fill(sums.begin(), sums.end(), Sum());
+        ThreadPool::instance().parallelFor(0, chunks, 1, [&](int c0, int c1) {
+            for (int chunk = c0; chunk < c1; ++chunk) {
+                Sum* local = sums.data() + static_cast<std::size_t>(chunk) * k;
+                const int end = std::min(count, (chunk + 1) * SampleChunk);
+                for (int i = chunk * SampleChunk; i < end; ++i) {
+                    const Sample& sample = samples[i];
+                    const int nearest = search.nearest(sample.lab);
+                    if (assignment[i] != nearest) {
+                        assignment[i] = nearest;
+                        changed[chunk] = 1;
+                    }
+                    const double w = static_cast<double>(sample.weight);
+                    local[nearest].weight += w;
+                    local[nearest].l += w * sample.lab.l;
+                    local[nearest].a += w * sample.lab.a;
+                    local[nearest].b += w * sample.lab.b;
+                }
+            }
+        });
+        if (std::find(changed.begin(), changed.end(), 1) == changed.end()) break;
+
+        // Update step, summing chunks in order so the palette does not depend on threads
+        for (std::size_t j = 0; j < k; ++j) {
+            Sum total;
+            for (int chunk = 0; chunk < chunks; ++chunk) {
+                const Sum& s = sums[static_cast<std::size_t>(chunk) * k + j];
+                total.weight += s.weight;
+                total.l += s.l;
+                total.a += s.a;
+                total.b += s.b;
+            }
+            if (total.weight > 0.0) {
+                palette[j] = {static_cast<float>(total.l / total.weight), static_cast<float>(total.a / total.weight),
+                              static_cast<float>(total.b / total.weight)};
+            }
+        }
+    }
+}
+
+} // namespace
+
+Quantizer::Quantizer(int colors, QuantizeMethod method)
+    : target(colors), method(method), cells(std::size_t(1) << (3 * HistogramBits))
+{
+    if (colors < 2 || colors > MaxColors) {
+        throw std::invalid_argument("Palette size must be between 2 and " + std::to_string(MaxColors));
+    }
+}
+
+void Quantizer::countRows(const Image& image, int rowBegin, int rowEnd)
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(image.height, rowEnd);
+    if (rowEnd <= rowBegin) return;
+    constexpr int shift = 8 - HistogramBits;
+    std::vector<Cell> local(cells.size());
+    const unsigned char* p = image.imageData + static_cast<std::size_t>(rowBegin) * image.width * 3;
+    const std::size_t pixels = static_cast<std::size_t>(rowEnd - rowBegin) * image.width;
+    for (std::size_t i = 0; i < pixels; ++i, p += 3) {
+        Cell& cell = local[(p[0] >> shift) << (2 * HistogramBits) | (p[1] >> shift) << HistogramBits | (p[2] >> shift)];
+        ++cell.count;
+        cell.red += p[0];
+        cell.green += p[1];
+        cell.blue += p[2];
+    }
+    std::lock_guard<std::mutex> lock(cellsMutex);
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        cells[i].count += local[i].count;
+        cells[i].red += local[i].red;
+        cells[i].green += local[i].green;
+        cells[i].blue += local[i].blue;
+    }
+}
+
+void Quantizer::choosePalette()
+{
+    std::vector<Sample> samples;
+    for (const Cell& cell : cells) {
+        if (cell.count == 0) continue;
+        const double count = static_cast<double>(cell.count);
+        Sample sample;
+        sample.rgb[0] = static_cast<float>(cell.red / count);
+        sample.rgb[1] = static_cast<float>(cell.green / count);
+        sample.rgb[2] = static_cast<float>(cell.blue / count);
+        sample.weight = cell.count;
+        sample.lab = toLab(sample.rgb[0], sample.rgb[1], sample.rgb[2]);
+        samples.push_back(sample);
+    }
+    if (samples.empty()) {
+        throw std::invalid_argument("Cannot quantize an empty image");
+    }
+
+    std::vector<Lab> palette = medianCut(samples, target);
+    if (method == QuantizeMethod::KMeans) {
+        refineKMeans(samples, palette);
+    }
+    colors.clear();
+    for (const Lab& lab : palette) colors.push_back(toRgb(lab));
+
+    // Nearest palette entry of the center of every cube cell, one red slice per task
+    constexpr int side = 1 << CubeBits;
+    constexpr int step = 256 / side;
+    std::vector<Lab> rounded;
+    for (const RgbColor& color : colors) rounded.push_back(toLab(color.r, color.g, color.b));
+    const PaletteSearch search(rounded);
+    cube.resize(static_cast<std::size_t>(side) * side * side);
+    ThreadPool::instance().parallelFor(0, side, 1, [&](int r0, int r1) {
+        for (int r = r0; r < r1; ++r) {
+            unsigned char* slice = cube.data() + static_cast<std::size_t>(r) * side * side;
+            for (int g = 0; g < side; ++g) {
+                for (int b = 0; b < side; ++b) {
+                    const Lab center = toLab(static_cast<float>(r * step + step / 2), static_cast<float>(g * step + step / 2),
+                                             static_cast<float>(b * step + step / 2));
+                    slice[g * side + b] = static_cast<unsigned char>(search.nearest(center));
+                }
+            }
+        }
+    });
+
+    // Dither by about the mean distance between neighbouring palette colors; the offset
+    // moves all three channels, so it is divided by sqrt(3)
+    double spacing = 0.0;
+    for (std::size_t i = 0; i < colors.size(); ++i) {
+        double nearest = std::numeric_limits<double>::max();
+        for (std::size_t j = 0; j < colors.size(); ++j) {
+            if (i == j) continue;
+            const double dr = colors[i].r - colors[j].r;
+            const double dg = colors[i].g - colors[j].g;
+            const double db = colors[i].b - colors[j].b;
+            nearest = std::min(nearest, std::sqrt(dr * dr + dg * dg + db * db));
+        }
+        if (colors.size() > 1) spacing += nearest;
+    }
+    spacing /= static_cast<double>(colors.size());
+    ditherSpread = static_cast<int>(std::min(255.0, spacing / std::sqrt(3.0)));
+}
+
+void Quantizer::mapRows(Image& image, bool dither, int rowBegin, int rowEnd) const
+{
+    if (cube.empty()) {
+        throw std::logic_error("Quantizer::mapRows() called before choosePalette()");
+    }
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(image.height, rowEnd);
+    constexpr int shift = 8 - CubeBits;
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        // Offsets of the row's 8-pixel Bayer period, centered on zero
+        int offsets[8] = {};
+        if (dither) {
+            for (int i = 0; i < 8; ++i) {
+                offsets[i] = (2 * Dither::bayerRank(i, y) + 1 - 64) * ditherSpread / 128;
+            }
+        }
+        unsigned char* p = image.imageData + static_cast<std::size_t>(y) * image.width * 3;
+        for (int x = 0; x < image.width; ++x, p += 3) {
+            const int offset = offsets[x & 7];
+            const int r = std::clamp(p[0] + offset, 0, 255) >> shift;
+            const int g = std::clamp(p[1] + offset, 0, 255) >> shift;
+            const int b = std::clamp(p[2] + offset, 0, 255) >> shift;
+            const RgbColor& color = colors[cube[(r << (2 * CubeBits)) | (g << CubeBits) | b]];
+            p[0] = color.r;
+            p[1] = color.g;
+            p[2] = color.b;
+        }
+    }
+}
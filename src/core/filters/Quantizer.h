@@ -0,0 +1,103 @@
+/**
+ * @file Quantizer.h
+ * @brief Color quantization (palette reduction) to at most 256 colors.
+ *
+ * This file contains the declaration of the Quantizer class used by
+ * ImageFilters::applyQuantize(). It picks a palette of N colors for an image and
+ * replaces every pixel by its nearest palette color, optionally with an ordered
+ * dither, so the result can be written as an indexed PNG (see EncodeOptions::pngPalette)
+ * or sent to palette-limited displays.
+ *
+ * @details The image is first reduced to a 32x32x32 color histogram that keeps the
+ * count and mean color of every occupied cell; that histogram is the sample set of
+ * the palette search, so the search costs the same for any image size. Median cut
+ * splits the samples into N boxes; k-means then refines the box colors in CIE Lab,
+ * where distances follow perceived differences, with the assignment step running in
+ * parallel. Pixels are mapped through a 64x64x64 lookup cube of nearest palette
+ * entries, built in parallel once per image.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef QUANTIZER_H
+#define QUANTIZER_H
+
+class Image;
+#include "FilterTypes.h"
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class Quantizer
+ * @brief Palette of one image and the mapping of its pixels.
+ *
+ * @example
+ * @code
+ * Quantizer quantizer(16, QuantizeMethod::KMeans);
+ * quantizer.countRows(image, 0, image.height); // bands may run concurrently
+ * quantizer.choosePalette();
+ * quantizer.mapRows(image, false, 0, image.height);
+ * @endcode
+ */
+class Quantizer
+{
+public:
+    /// Largest palette, the limit of indexed PNG files
+    static constexpr int MaxColors = 256;
+
+    /**
+     * @brief Prepares a quantizer to @p colors colors.
+     * @throws std::invalid_argument if @p colors is outside [2, MaxColors]
+     */
+    Quantizer(int colors, QuantizeMethod method);
+
+    /**
+     * @brief Adds rows [rowBegin, rowEnd) of @p image to the color histogram.
+     *
+     * Counts into private cells and merges them once, so bands may run concurrently;
+     * use few large bands, as every call clears and merges a 1 MB histogram.
+     */
+    void countRows(const Image& image, int rowBegin, int rowEnd);
+
+    /**
+     * @brief Chooses the palette from the counted colors and builds the lookup cube.
+     *
+     * Runs on the shared thread pool. The palette may be smaller than requested when the
+     * image has fewer distinct colors.
+     */
+    void choosePalette();
+
+    /** @brief Palette chosen by choosePalette(). */
+    const std::vector<RgbColor>& palette() const { return colors; }
+
+    /**
+     * @brief Replaces the pixels of rows [rowBegin, rowEnd) by palette colors.
+     * @param dither Add a Bayer offset scaled to the palette spacing first, which trades
+     *        banding in gradients for a fine regular pattern
+     */
+    void mapRows(Image& image, bool dither, int rowBegin, int rowEnd) const;
+
+private:
+    /// Pixels of one 32x32x32 histogram cell
+    struct Cell {
+        std::uint64_t count = 0;
+        std::uint64_t red = 0;
+        std::uint64_t green = 0;
+        std::uint64_t blue = 0;
+    };
+
+    int target;
+    QuantizeMethod method;
+    std::vector<Cell> cells;
+    std::mutex cellsMutex;
+    std::vector<RgbColor> colors;
+    std::vector<unsigned char> cube; ///< Palette index of each 64x64x64 cell
+    int ditherSpread = 0;            ///< Dither amplitude in levels per channel
+};
+
+#endif // QUANTIZER_H
@@ -0,0 +1,367 @@
+/**
+ * @file Resampler.cpp
+ * @brief Implementation of the separable fixed-point resampler.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "Resampler.h"
+#include "LinearLight.h"
+#include "image/Image_Class.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+constexpr int WeightBits = 14;          ///< Fixed-point bits of a weight
+constexpr int IntermediateBits = 6;     ///< Fractional bits kept between the two passes
+constexpr int IntermediateMax = 255 << IntermediateBits;
+constexpr int LinearFractionBits = 2;   ///< Fractional bits kept for 12-bit linear light
+
+const double Pi = 3.14159265358979323846;
+
+double triangle(double x)
+{
+    x = std::fabs(x);
+    return x < 1.0 ? 1.0 - x : 0.0;
+}
+
+double catmullRom(double x)
+{
+    x = std::fabs(x);
+    if (x < 1.0) return (1.5 * x - 2.5) * x * x + 1.0;
+    if (x < 2.0) return ((-0.5 * x + 2.5) * x - 4.0) * x + 2.0;
+    return 0.0;
+}
+
+double lanczos3(double x)
+{
+    if (x == 0.0) return 1.0;
+    if (x <= -3.0 || x >= 3.0) return 0.0;
+    const double px = Pi * x;
+    return 3.0 * std::sin(px) * std::sin(px / 3.0) / (px * px);
+}
+
+inline unsigned char clampToByte(int v)
+{
+    return static_cast<unsigned char>(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Horizontal pass of one source row held as three channel planes.
+ *
+ * Taps are taken eight at a time with _mm_madd_epi16. Weight rows are zero-padded to a
+ * multiple of eight taps and every plane is padded by @p maxTaps values, so the last tap
+ * group of a pixel never reads outside either. Sums are exact, so the result equals the
+ * scalar loop.
+ */
+void convolvePlanes(const std::int16_t* planes, std::size_t planeStride, const int* first, const int* taps,
+                    const std::int16_t* weights, int maxTaps, int width, int shift, int maxValue,
+                    std::int16_t* out)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_setr_epi32(1 << (shift - 1), 1 << (shift - 1), 1 << (shift - 1), 0);
+    const __m128i ceiling = _mm_set1_epi16(static_cast<short>(maxValue));
+    for (int x = 0; x < width; ++x) {
+        const std::int16_t* w = weights + static_cast<std::size_t>(x) * maxTaps;
+        const std::int16_t* red = planes + first[x];
+        const std::int16_t* green = red + planeStride;
+        const std::int16_t* blue = green + planeStride;
+        __m128i r = zero;
+        __m128i g = zero;
+        __m128i b = zero;
+        for (int k = 0; k < taps[x]; k += 8) {
+            const __m128i wk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + k));
+            r = _mm_add_epi32(r, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(red + k)), wk));
+            g = _mm_add_epi32(g, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(green + k)), wk));
+            b = _mm_add_epi32(b, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blue + k)), wk));
+        }
+        // Reduce the three vectors to one [r, g, b, 0]
+        const __m128i rg = _mm_add_epi32(_mm_unpacklo_epi32(r, g), _mm_unpackhi_epi32(r, g));
+        const __m128i bz = _mm_add_epi32(_mm_unpacklo_epi32(b, zero), _mm_unpackhi_epi32(b, zero));
+        __m128i sum = _mm_add_epi32(_mm_unpacklo_epi64(rg, bz), _mm_unpackhi_epi64(rg, bz));
+        sum = _mm_srai_epi32(_mm_add_epi32(sum, bias), shift);
+        const __m128i value = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(sum, sum), zero), ceiling);
+        out[x * 3 + 0] = static_cast<std::int16_t>(_mm_extract_epi16(value, 0));
+        out[x * 3 + 1] = static_cast<std::int16_t>(_mm_extract_epi16(value, 1));
+        out[x * 3 + 2] = static_cast<std::int16_t>(_mm_extract_epi16(value, 2));
+    }
+}
+#endif
+
+/// Weights @p w0 and @p w1 as the 16-bit pair of one _mm_madd_epi16 lane
+inline int weightPair(int w0, int w1)
+{
+    return static_cast<int>(static_cast<std::uint32_t>(static_cast<std::uint16_t>(w1)) << 16
+                            | static_cast<std::uint16_t>(w0));
+}
+
+/**
+ * @brief Vertical pass: acc[i] = bias + sum of weights[k] * lines[k][i] over @p taps lines.
+ *
+ * Lines are taken in pairs, interleaved and multiplied with _mm_madd_epi16, sixteen
+ * values per step with AVX2 and eight with SSE2; the scalar loop handles the tail.
+ */
+void accumulateLines(const std::int16_t* const* lines, const std::int16_t* weights, int taps, int bias,
+                     int* acc, std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 16 <= count; i += 16) {
+        __m256i low = _mm256_set1_epi32(bias);
+        __m256i high = low;
+        for (int k = 0; k < taps; k += 2) {
+            const bool pair = k + 1 < taps;
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lines[k] + i));
+            const __m256i b = pair ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lines[k + 1] + i))
+                                   : _mm256_setzero_si256();
+            const __m256i w = _mm256_set1_epi32(weightPair(weights[k], pair ? weights[k + 1] : 0));
+            low = _mm256_add_epi32(low, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w));
+            high = _mm256_add_epi32(high, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w));
+        }
+        // Unpacks work within 128-bit lanes; put values i..i+7 and i+8..i+15 back in order
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + i), _mm256_permute2x128_si256(low, high, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + i + 8), _mm256_permute2x128_si256(low, high, 0x31));
+    }
+#endif
+#if defined(__SSE2__)
+    for (; i + 8 <= count; i += 8) {
+        __m128i low = _mm_set1_epi32(bias);
+        __m128i high = low;
+        for (int k = 0; k < taps; k += 2) {
+            const bool pair = k + 1 < taps;
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lines[k] + i));
+            const __m128i b = pair ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(lines[k + 1] + i))
+                                   : _mm_setzero_si128();
+            const __m128i w = _mm_set1_epi32(weightPair(weights[k], pair ? weights[k + 1] : 0));
+            low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w));
+            high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + i), low);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + i + 4), high);
+    }
+#endif
+    for (; i < count; ++i) {
+        int sum = bias;
+        for (int k = 0; k < taps; ++k) sum += weights[k] * lines[k][i];
+        acc[i] = sum;
+    }
+}
+
+} // namespace
+
+Resampler::Resampler(int srcWidth, int srcHeight, int dstWidth, int dstHeight, ResizeFilter filter,
+                     WorkingSpace space)
+    : filter(filter), space(space)
+{
+    if (srcWidth < 1 || srcHeight < 1 || dstWidth < 1 || dstHeight < 1) {
+        throw std::invalid_argument("Image dimensions must be at least 1x1");
+    }
+    columns = buildAxis(srcWidth, dstWidth, filter);
+    rows = buildAxis(srcHeight, dstHeight, filter);
+}
+
+Resampler::Axis Resampler::buildAxis(int srcSize, int dstSize, ResizeFilter filter)
+{
+    Axis axis;
+    axis.first.resize(dstSize);
+    axis.taps.assign(dstSize, 1);
+    const double scale = static_cast<double>(srcSize) / dstSize;
+
+    if (filter == ResizeFilter::Nearest) {
+        for (int i = 0; i < dstSize; ++i) {
+            axis.first[i] = std::min(static_cast<int>(i * scale), srcSize - 1);
+        }
+        return axis;
+    }
+
+    double (*kernel)(double) = triangle;
+    double support = 0.5;
+    if (filter == ResizeFilter::Bilinear) support = 1.0;
+    else if (filter == ResizeFilter::Bicubic) { kernel = catmullRom; support = 2.0; }
+    else if (filter == ResizeFilter::Lanczos) { kernel = lanczos3; support = 3.0; }
+
+    // Stretch the kernel when downscaling so it covers every source pixel
+    const double filterScale = std::max(scale, 1.0);
+    const double radius = support * filterScale;
+    // Rounded up to whole groups of eight taps for the SIMD horizontal pass
+    axis.maxTaps = (static_cast<int>(std::ceil(radius * 2.0)) + 2 + 7) / 8 * 8;
+    axis.weights.assign(static_cast<std::size_t>(dstSize) * axis.maxTaps, 0);
+
+    std::vector<double> w(axis.maxTaps);
+    for (int i = 0; i < dstSize; ++i) {
+        int lo, hi;
+        if (filter == ResizeFilter::Area) {
+            // Overlap of source pixel j with the destination footprint [i * scale, (i + 1) * scale)
+            const double left = i * scale;
+            const double right = (i + 1) * scale;
+            lo = std::max(static_cast<int>(std::floor(left)), 0);
+            hi = std::min(static_cast<int>(std::ceil(right)), srcSize);
+            for (int j = lo; j < hi; ++j) {
+                w[j - lo] = std::min(j + 1.0, right) - std::max(static_cast<double>(j), left);
+            }
+        } else {
+            const double center = (i + 0.5) * scale;
+            lo = std::max(static_cast<int>(std::floor(center - radius + 0.5)), 0);
+            hi = std::min(static_cast<int>(std::floor(center + radius + 0.5)), srcSize);
+            for (int j = lo; j < hi; ++j) {
+                w[j - lo] = kernel((j + 0.5 - center) / filterScale);
+            }
+        }
+
+        // Drop zero taps at both ends
+        while (hi - lo > 1 && w[0] == 0.0) {
+            std::copy(w.begin() + 1, w.begin() + (hi - lo), w.begin());
+            ++lo;
+        }
+        while (hi - lo > 1 && w[hi - lo - 1] == 0.0) --hi;
+        const int taps = hi - lo;
+
+        double sum = 0.0;
+        for (int k = 0; k < taps; ++k) sum += w[k];
+
+        // Quantize the running sum rather than each weight, so the weights add up to
+        // exactly 1.0 and every prefix stays within half a unit of the true value
+        std::int16_t* q = axis.weights.data() + static_cast<std::size_t>(i) * axis.maxTaps;
+        double running = 0.0;
+        long previous = 0;
+        for (int k = 0; k < taps; ++k) {
+            running += w[k];
+            const long next = (k == taps - 1) ? (1L << WeightBits) : std::lround(running / sum * (1 << WeightBits));
+            q[k] = static_cast<std::int16_t>(next - previous);
+            previous = next;
+        }
+
+        axis.first[i] = lo;
+        axis.taps[i] = taps;
+    }
+    return axis;
+}
+
+void Resampler::nearestRows(const Image& src, Image& dst, int rowBegin, int rowEnd) const
+{
+    const std::size_t srcStride = static_cast<std::size_t>(src.width) * 3;
+    const std::size_t dstStride = static_cast<std::size_t>(dst.width) * 3;
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const unsigned char* in = src.imageData + rows.first[y] * srcStride;
+        unsigned char* out = dst.imageData + y * dstStride;
+        for (int x = 0; x < dst.width; ++x) {
+            std::memcpy(out + x * 3, in + columns.first[x] * 3, 3);
+        }
+    }
+}
+
+void Resampler::resizeRows(const Image& src, Image& dst, int rowBegin, int rowEnd) const
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(dst.height, rowEnd);
+    if (rowEnd <= rowBegin) return;
+    if (filter == ResizeFilter::Nearest) {
+        nearestRows(src, dst, rowBegin, rowEnd);
+        return;
+    }
+
+    const int dstWidth = dst.width;
+    const std::size_t srcStride = static_cast<std::size_t>(src.width) * 3;
+    const std::size_t dstStride = static_cast<std::size_t>(dstWidth) * 3;
+
+    // Source rows the band reads
+    int srcBegin = rows.first[rowBegin];
+    int srcEnd = srcBegin;
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        srcBegin = std::min(srcBegin, rows.first[y]);
+        srcEnd = std::max(srcEnd, rows.first[y] + rows.taps[y]);
+    }
+
+    // Linear light is 12 bits wide, so it keeps fewer fractional bits in the same 14-bit range
+    const bool linear = space == WorkingSpace::Linear;
+    const int fractionBits = linear ? LinearFractionBits : IntermediateBits;
+    const int intermediateMax = linear ? LinearLight::Max << LinearFractionBits : IntermediateMax;
+
+    // Horizontal pass: each source row to the destination width, with fractional bits
+    std::vector<std::int16_t> horizontal(static_cast<std::size_t>(srcEnd - srcBegin) * dstStride);
+    const int hShift = WeightBits - fractionBits;
+#if defined(__SSE2__)
+    // Channel planes of the source row, padded so a tap group never reads past them
+    const std::size_t planeStride = static_cast<std::size_t>(src.width) + columns.maxTaps;
+    std::vector<std::int16_t> planes(3 * planeStride, 0);
+    const auto convolveRow = [&](const auto* in, std::int16_t* out) {
+        for (int i = 0; i < src.width; ++i) {
+            planes[i] = static_cast<std::int16_t>(in[i * 3 + 0]);
+            planes[planeStride + i] = static_cast<std::int16_t>(in[i * 3 + 1]);
+            planes[2 * planeStride + i] = static_cast<std::int16_t>(in[i * 3 + 2]);
+        }
+        convolvePlanes(planes.data(), planeStride, columns.first.data(), columns.taps.data(), columns.weights.data(),
+                       columns.maxTaps, dstWidth, hShift, intermediateMax, out);
+    };
+#else
+    const auto convolveRow = [&](const auto* in, std::int16_t* out) {
+        for (int x = 0; x < dstWidth; ++x) {
+            const std::int16_t* w = columns.weights.data() + static_cast<std::size_t>(x) * columns.maxTaps;
+            const auto* p = in + columns.first[x] * 3;
+            const int taps = columns.taps[x];
+            int r = 1 << (hShift - 1);
+            int g = r;
+            int b = r;
+            for (int k = 0; k < taps; ++k) {
+                r += w[k] * p[k * 3 + 0];
+                g += w[k] * p[k * 3 + 1];
+                b += w[k] * p[k * 3 + 2];
+            }
+            out[x * 3 + 0] = static_cast<std::int16_t>(std::clamp(r >> hShift, 0, intermediateMax));
+            out[x * 3 + 1] = static_cast<std::int16_t>(std::clamp(g >> hShift, 0, intermediateMax));
+            out[x * 3 + 2] = static_cast<std::int16_t>(std::clamp(b >> hShift, 0, intermediateMax));
+        }
+    };
+#endif
+    const std::uint16_t* decode = LinearLight::decodeTable();
+    std::vector<std::uint16_t> decoded(linear ? srcStride : 0);
+    for (int sy = srcBegin; sy < srcEnd; ++sy) {
+        const unsigned char* in = src.imageData + sy * srcStride;
+        std::int16_t* out = horizontal.data() + (sy - srcBegin) * dstStride;
+        if (linear) {
+            for (std::size_t i = 0; i < srcStride; ++i) decoded[i] = decode[in[i]];
+            convolveRow(decoded.data(), out);
+        } else {
+            convolveRow(in, out);
+        }
+    }
+
+    // Vertical pass: whole rows at a time so the inner loop is a straight multiply-add
+    const int vShift = WeightBits + fractionBits;
+    const unsigned char* encode = LinearLight::encodeTable();
+    std::vector<int> acc(dstStride);
+    std::vector<const std::int16_t*> lines(rows.maxTaps);
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        for (int k = 0; k < rows.taps[y]; ++k) {
+            lines[k] = horizontal.data() + (rows.first[y] + k - srcBegin) * dstStride;
+        }
+        accumulateLines(lines.data(), rows.weights.data() + static_cast<std::size_t>(y) * rows.maxTaps, rows.taps[y],
+                        1 << (vShift - 1), acc.data(), dstStride);
+        unsigned char* out = dst.imageData + y * dstStride;
+        if (linear) {
+            for (std::size_t i = 0; i < dstStride; ++i) {
+                out[i] = encode[std::clamp(acc[i] >> vShift, 0, LinearLight::Max)];
+            }
+        } else {
+            for (std::size_t i = 0; i < dstStride; ++i) {
+                out[i] = clampToByte(acc[i] >> vShift);
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file Resampler.h
+ * @brief Separable image resizing with nearest, bilinear, bicubic, Lanczos and area filters.
+ *
+ * This file contains the declaration of the Resampler used by the Resize filter. A
+ * Resampler is built once for a source and destination size: it precomputes, for every
+ * destination column and row, the first contributing source pixel and the fixed-point
+ * weights of all contributing pixels. Resizing is then two 1-D convolutions per row
+ * band, horizontal first, with integer arithmetic only.
+ *
+ * @details When downscaling, the filter kernel is stretched by the scale factor, so every
+ * source pixel contributes to the output (antialiasing) rather than being skipped. The
+ * Area filter weights every source pixel by how much of it the destination pixel covers.
+ * Nearest reproduces the original resize exactly (source index = floor(x * ratio)).
+ *
+ * Weights are 14-bit fixed point and the intermediate rows keep 6 fractional bits,
+ * so the result is within one level of a floating-point implementation.
+ *
+ * Both passes multiply 16-bit values by 16-bit weights with _mm_madd_epi16 where SSE2 is
+ * available (the vertical pass sixteen values at a time with AVX2). The sums are exact
+ * integers, so every build produces the same bytes as the scalar loops.
+ *
+ * In WorkingSpace::Linear each source row is decoded to 12-bit linear light as the
+ * horizontal pass reads it, the intermediate rows keep 2 fractional bits of it, and the
+ * vertical pass encodes back to sRGB, so only the band's intermediate rows are stored.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+class Image;
+#include "FilterTypes.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class Resampler
+ * @brief Precomputed separable resize from one image size to another.
+ */
+class Resampler
+{
+public:
+    /**
+     * @brief Precomputes the weights of a resize.
+     * @param srcWidth Source width in pixels
+     * @param srcHeight Source height in pixels
+     * @param dstWidth Destination width in pixels
+     * @param dstHeight Destination height in pixels
+     * @param filter Reconstruction filter
+     * @param space Space in which source pixels are weighted (Nearest copies pixels either way)
+     * @throws std::invalid_argument if any size is less than 1
+     */
+    Resampler(int srcWidth, int srcHeight, int dstWidth, int dstHeight, ResizeFilter filter,
+              WorkingSpace space = WorkingSpace::Srgb);
+
+    /**
+     * @brief Writes destination rows [rowBegin, rowEnd) of the resized image.
+     *
+     * Bands are independent, so callers can run them on different threads.
+     *
+     * @param src Source image of the size given to the constructor
+     * @param dst Destination image of the size given to the constructor
+     * @param rowBegin First destination row
+     * @param rowEnd One past the last destination row
+     */
+    void resizeRows(const Image& src, Image& dst, int rowBegin, int rowEnd) const;
+
+private:
+    /**
+     * @brief Contributions along one axis: destination index i reads taps[i] source
+     *        pixels starting at first[i], with weights at weights[i * maxTaps].
+     */
+    struct Axis {
+        std::vector<int> first;
+        std::vector<int> taps;
+        std::vector<std::int16_t> weights;
+        int maxTaps = 1;
+    };
+
+    static Axis buildAxis(int srcSize, int dstSize, ResizeFilter filter);
+
+    void nearestRows(const Image& src, Image& dst, int rowBegin, int rowEnd) const;
+
+    ResizeFilter filter;
+    WorkingSpace space;
+    Axis columns;
+    Axis rows;
+};
+
+#endif // RESAMPLER_H
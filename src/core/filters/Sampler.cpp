@@ -0,0 +1,331 @@
+/**
+ * @file Sampler.cpp
+ * @brief Implementation of nearest, bilinear and bicubic image sampling.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "Sampler.h"
+#include "image/Image_Class.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/// Source pixels plus the rule for taps outside them
+struct Source {
+    const unsigned char* data;
+    int width;
+    int height;
+    std::size_t stride;
+    EdgeMode edge;
+    unsigned char background[3];
+
+    Source(const Image& image, const RgbColor& color, EdgeMode edge)
+        : data(image.imageData), width(image.width), height(image.height),
+          stride(static_cast<std::size_t>(image.width) * 3), edge(edge), background{color.r, color.g, color.b}
+    {
+    }
+
+    /// Index of the pixel an out-of-range index @p i reads, along an axis of @p n pixels
+    int resolve(int i, int n) const
+    {
+        if (edge == EdgeMode::Clamp) return i < 0 ? 0 : (i >= n ? n - 1 : i);
+        // Reflect: ... c b a | a b c ... c b a | a b c ...
+        const int period = 2 * n;
+        int m = i % period;
+        if (m < 0) m += period;
+        return m < n ? m : period - 1 - m;
+    }
+
+    const unsigned char* tap(int x, int y) const
+    {
+        if (x < 0 || y < 0 || x >= width || y >= height) {
+            if (edge == EdgeMode::Constant) return background;
+            x = resolve(x, width);
+            y = resolve(y, height);
+        }
+        return data + y * stride + static_cast<std::size_t>(x) * 3;
+    }
+
+    /// True if every tap of a kernel reaching @p reach pixels reads the background
+    /// (also true for NaN and infinite coordinates, whatever the edge mode). Otherwise
+    /// brings x and y into a range where later int conversions cannot overflow.
+    bool onlyBackground(double& x, double& y, double reach) const
+    {
+        if (!std::isfinite(x) || !std::isfinite(y)) return true;
+        if (edge == EdgeMode::Constant) {
+            return !(x > -1.0 - reach && y > -1.0 - reach && x < width + reach && y < height + reach);
+        }
+        const double limit = 1e8;
+        x = x < -limit ? -limit : (x > limit ? limit : x);
+        y = y < -limit ? -limit : (y > limit ? limit : y);
+        return false;
+    }
+};
+
+/// floor() for coordinates already known to be in int range, without a libm call
+inline int floorToInt(double v)
+{
+    const int i = static_cast<int>(v);
+    return i - (v < i);
+}
+
+inline void copyPixel(const unsigned char* p, unsigned char* out)
+{
+    out[0] = p[0];
+    out[1] = p[1];
+    out[2] = p[2];
+}
+
+inline unsigned char clampByte(float v)
+{
+    return v <= 0.0f ? 0 : v >= 255.0f ? 255 : static_cast<unsigned char>(v + 0.5f);
+}
+
+struct Nearest {
+    void operator()(const Source& s, double x, double y, unsigned char* out) const
+    {
+        if (s.onlyBackground(x, y, 1.0)) { copyPixel(s.background, out); return; }
+        copyPixel(s.tap(floorToInt(x + 0.5), floorToInt(y + 0.5)), out);
+    }
+};
+
+struct Bilinear {
+    void operator()(const Source& s, double x, double y, unsigned char* out) const
+    {
+        if (s.onlyBackground(x, y, 1.0)) { copyPixel(s.background, out); return; }
+        const int x0 = floorToInt(x);
+        const int y0 = floorToInt(y);
+        const float ax = static_cast<float>(x - x0);
+        const float ay = static_cast<float>(y - y0);
+
+        const unsigned char* p00;
+        const unsigned char* p10;
+        const unsigned char* p01;
+        const unsigned char* p11;
+        if (x0 >= 0 && y0 >= 0 && x0 + 1 < s.width && y0 + 1 < s.height) {
+            p00 = s.data + y0 * s.stride + static_cast<std::size_t>(x0) * 3;
+            p10 = p00 + 3;
+            p01 = p00 + s.stride;
+            p11 = p01 + 3;
+        } else {
+            p00 = s.tap(x0, y0);
+            p10 = s.tap(x0 + 1, y0);
+            p01 = s.tap(x0, y0 + 1);
+            p11 = s.tap(x0 + 1, y0 + 1);
+        }
+        for (int c = 0; c < 3; ++c) {
+            const float top = p00[c] + (p10[c] - p00[c]) * ax;
+            const float bottom = p01[c] + (p11[c] - p01[c]) * ax;
+            out[c] = static_cast<unsigned char>(top + (bottom - top) * ay + 0.5f);
+        }
+    }
+};
+
+/// Bilinear with the fractions rounded to 8 bits and integer accumulation; within one
+/// level of Bilinear
+struct BilinearFixed {
+    void operator()(const Source& s, double x, double y, unsigned char* out) const
+    {
+        if (s.onlyBackground(x, y, 1.0)) { copyPixel(s.background, out); return; }
+        const int x0 = floorToInt(x);
+        const int y0 = floorToInt(y);
+        const int fx = static_cast<int>(static_cast<float>(x - x0) * 256.0f + 0.5f);
+        const int fy = static_cast<int>(static_cast<float>(y - y0) * 256.0f + 0.5f);
+
+        const unsigned char* p00;
+        const unsigned char* p10;
+        const unsigned char* p01;
+        const unsigned char* p11;
+        if (x0 >= 0 && y0 >= 0 && x0 + 1 < s.width && y0 + 1 < s.height) {
+            p00 = s.data + y0 * s.stride + static_cast<std::size_t>(x0) * 3;
+            p10 = p00 + 3;
+            p01 = p00 + s.stride;
+            p11 = p01 + 3;
+        } else {
+            p00 = s.tap(x0, y0);
+            p10 = s.tap(x0 + 1, y0);
+            p01 = s.tap(x0, y0 + 1);
+            p11 = s.tap(x0 + 1, y0 + 1);
+        }
+        for (int c = 0; c < 3; ++c) {
+            // Q8 rows, then Q16 result
+            const int top = (p00[c] << 8) + (p10[c] - p00[c]) * fx;
+            const int bottom = (p01[c] << 8) + (p11[c] - p01[c]) * fx;
+            out[c] = static_cast<unsigned char>(((top << 8) + (bottom - top) * fy + 32768) >> 16);
+        }
+    }
+};
+
+/// Catmull-Rom weights of the taps at -1, 0, +1, +2 for a fractional offset t in [0, 1)
+inline void cubicWeights(float t, float w[4])
+{
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    w[0] = -0.5f * t3 + t2 - 0.5f * t;
+    w[1] = 1.5f * t3 - 2.5f * t2 + 1.0f;
+    w[2] = -1.5f * t3 + 2.0f * t2 + 0.5f * t;
+    w[3] = 0.5f * t3 - 0.5f * t2;
+}
+
+struct Bicubic {
+    void operator()(const Source& s, double x, double y, unsigned char* out) const
+    {
+        if (s.onlyBackground(x, y, 2.0)) { copyPixel(s.background, out); return; }
+        const int x0 = floorToInt(x);
+        const int y0 = floorToInt(y);
+        float wx[4], wy[4];
+        cubicWeights(static_cast<float>(x - x0), wx);
+        cubicWeights(static_cast<float>(y - y0), wy);
+
+        const bool inside = x0 >= 1 && y0 >= 1 && x0 + 2 < s.width && y0 + 2 < s.height;
+        float sum[3] = {0.0f, 0.0f, 0.0f};
+        for (int j = 0; j < 4; ++j) {
+            float row[3] = {0.0f, 0.0f, 0.0f};
+            for (int i = 0; i < 4; ++i) {
+                const unsigned char* p = inside
+                    ? s.data + (y0 - 1 + j) * s.stride + static_cast<std::size_t>(x0 - 1 + i) * 3
+                    : s.tap(x0 - 1 + i, y0 - 1 + j);
+                row[0] += p[0] * wx[i];
+                row[1] += p[1] * wx[i];
+                row[2] += p[2] * wx[i];
+            }
+            sum[0] += row[0] * wy[j];
+            sum[1] += row[1] * wy[j];
+            sum[2] += row[2] * wy[j];
+        }
+        out[0] = clampByte(sum[0]);
+        out[1] = clampByte(sum[1]);
+        out[2] = clampByte(sum[2]);
+    }
+};
+
+template <typename Kernel>
+void lineWith(const Source& s, Kernel kernel, double x, double y, double stepX, double stepY, int count, unsigned char* out)
+{
+    for (int i = 0; i < count; ++i) {
+        kernel(s, x + i * stepX, y + i * stepY, out + i * 3);
+    }
+}
+
+template <typename Kernel>
+void pointsWith(const Source& s, Kernel kernel, const float* xs, const float* ys, int count, unsigned char* out)
+{
+    for (int i = 0; i < count; ++i) {
+        kernel(s, xs[i], ys[i], out + i * 3);
+    }
+}
+
+#if defined(__AVX2__)
+/**
+ * @brief BilinearFixed of groups of eight points with AVX2 gathers.
+ *
+ * A group whose 2x2 neighbourhoods all lie inside the source gathers the four corner
+ * pixels of its eight points as 32-bit words and interpolates them in 32-bit lanes with
+ * the scalar formulas, so results are identical; other groups use BilinearFixed.
+ * @return Number of leading points sampled (a multiple of eight)
+ */
+int gatherBilinearFixed(const Source& s, const float* xs, const float* ys, int count, unsigned char* out)
+{
+    // Byte offsets are 32-bit lanes
+    if (s.stride * static_cast<std::size_t>(s.height) >= (std::size_t(1) << 31)) return 0;
+    const int* base = reinterpret_cast<const int*>(s.data);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 xLimit = _mm256_set1_ps(static_cast<float>(s.width - 1));
+    const __m256 yLimit = _mm256_set1_ps(static_cast<float>(s.height - 1));
+    const __m256i stride = _mm256_set1_epi32(static_cast<int>(s.stride));
+    const __m256i byteMask = _mm256_set1_epi32(0xFF);
+    const __m256i half = _mm256_set1_epi32(32768);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 x = _mm256_loadu_ps(xs + i);
+        const __m256 y = _mm256_loadu_ps(ys + i);
+        // floor(x) + 1 < width and floor(y) + 1 < height; false for NaN
+        const __m256 inside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(x, zero, _CMP_GE_OQ), _mm256_cmp_ps(x, xLimit, _CMP_LT_OQ)),
+                                            _mm256_and_ps(_mm256_cmp_ps(y, zero, _CMP_GE_OQ), _mm256_cmp_ps(y, yLimit, _CMP_LT_OQ)));
+        if (_mm256_movemask_ps(inside) != 0xFF) {
+            pointsWith(s, BilinearFixed(), xs + i, ys + i, 8, out + i * 3);
+            continue;
+        }
+        const __m256 floorX = _mm256_floor_ps(x);
+        const __m256 floorY = _mm256_floor_ps(y);
+        const __m256 scale = _mm256_set1_ps(256.0f);
+        const __m256 round = _mm256_set1_ps(0.5f);
+        const __m256i fx = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(x, floorX), scale), round));
+        const __m256i fy = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(y, floorY), scale), round));
+        const __m256i offset = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_cvttps_epi32(floorY), stride),
+                                                _mm256_mullo_epi32(_mm256_cvttps_epi32(floorX), _mm256_set1_epi32(3)));
+        const __m256i below = _mm256_add_epi32(offset, stride);
+        // Each word holds R, G, B and one extra byte. The bottom-right pixel may be the last
+        // of the image, so its word is read one byte early and shifted down.
+        const __m256i p00 = _mm256_i32gather_epi32(base, offset, 1);
+        const __m256i p10 = _mm256_i32gather_epi32(base, _mm256_add_epi32(offset, _mm256_set1_epi32(3)), 1);
+        const __m256i p01 = _mm256_i32gather_epi32(base, below, 1);
+        const __m256i p11 = _mm256_srli_epi32(_mm256_i32gather_epi32(base, _mm256_add_epi32(below, _mm256_set1_epi32(2)), 1), 8);
+
+        alignas(32) int channels[3][8];
+        for (int c = 0; c < 3; ++c) {
+            const __m256i a00 = _mm256_and_si256(_mm256_srli_epi32(p00, 8 * c), byteMask);
+            const __m256i a10 = _mm256_and_si256(_mm256_srli_epi32(p10, 8 * c), byteMask);
+            const __m256i a01 = _mm256_and_si256(_mm256_srli_epi32(p01, 8 * c), byteMask);
+            const __m256i a11 = _mm256_and_si256(_mm256_srli_epi32(p11, 8 * c), byteMask);
+            const __m256i top = _mm256_add_epi32(_mm256_slli_epi32(a00, 8), _mm256_mullo_epi32(_mm256_sub_epi32(a10, a00), fx));
+            const __m256i bottom = _mm256_add_epi32(_mm256_slli_epi32(a01, 8), _mm256_mullo_epi32(_mm256_sub_epi32(a11, a01), fx));
+            const __m256i value = _mm256_add_epi32(_mm256_slli_epi32(top, 8), _mm256_mullo_epi32(_mm256_sub_epi32(bottom, top), fy));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(channels[c]), _mm256_srli_epi32(_mm256_add_epi32(value, half), 16));
+        }
+        unsigned char* o = out + i * 3;
+        for (int k = 0; k < 8; ++k) {
+            o[k * 3 + 0] = static_cast<unsigned char>(channels[0][k]);
+            o[k * 3 + 1] = static_cast<unsigned char>(channels[1][k]);
+            o[k * 3 + 2] = static_cast<unsigned char>(channels[2][k]);
+        }
+    }
+    return i;
+}
+#endif
+
+} // namespace
+
+void Sampler::sampleLine(const Image& src, Interpolation mode, double x, double y,
+                         double stepX, double stepY, int count,
+                         const RgbColor& background, unsigned char* out, EdgeMode edge)
+{
+    const Source s(src, background, edge);
+    switch (mode) {
+    case Interpolation::Nearest: lineWith(s, Nearest(), x, y, stepX, stepY, count, out); break;
+    case Interpolation::Bilinear: lineWith(s, Bilinear(), x, y, stepX, stepY, count, out); break;
+    case Interpolation::Bicubic: lineWith(s, Bicubic(), x, y, stepX, stepY, count, out); break;
+    }
+}
+
+void Sampler::samplePoints(const Image& src, Interpolation mode, const float* xs, const float* ys,
+                           int count, const RgbColor& background, unsigned char* out, EdgeMode edge)
+{
+    const Source s(src, background, edge);
+    switch (mode) {
+    case Interpolation::Nearest: pointsWith(s, Nearest(), xs, ys, count, out); break;
+    case Interpolation::Bilinear: pointsWith(s, Bilinear(), xs, ys, count, out); break;
+    case Interpolation::Bicubic: pointsWith(s, Bicubic(), xs, ys, count, out); break;
+    }
+}
+
+void Sampler::samplePointsFixed(const Image& src, const float* xs, const float* ys, int count,
+                                const RgbColor& background, unsigned char* out, EdgeMode edge)
+{
+    const Source s(src, background, edge);
+    int done = 0;
+#if defined(__AVX2__)
+    done = gatherBilinearFixed(s, xs, ys, count, out);
+#endif
+    pointsWith(s, BilinearFixed(), xs + done, ys + done, count - done, out + done * 3);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file WarpEngine.cpp
+ * @brief Implementation of the remap table cache and gather pass.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "WarpEngine.h"
+#include "Sampler.h"
+#include "image/Image_Class.h"
+#include "parallel/ThreadPool.h"
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+
+namespace {
+
+struct CacheEntry {
+    WarpEngine::Key key;
+    std::shared_ptr<const RemapTable> table;
+};
+
+/// Most recently used first
+struct TableCache {
+    std::mutex mutex;
+    std::list<CacheEntry> entries;
+    std::size_t bytes = 0;
+    std::size_t limit = std::size_t(256) << 20;
+
+    void evictTo(std::size_t budget)
+    {
+        while (bytes > budget && !entries.empty()) {
+            bytes -= entries.back().table->bytes();
+            entries.pop_back();
+        }
+    }
+};
+
+TableCache& cache()
+{
+    static TableCache instance;
+    return instance;
+}
+
+} // namespace
+
+RemapTable::RemapTable(int width, int height)
+    : tableWidth(width), tableHeight(height)
+{
+    if (width < 1 || height < 1) {
+        throw std::invalid_argument("Image dimensions must be at least 1x1");
+    }
+    const std::size_t count = static_cast<std::size_t>(width) * height;
+    xs.resize(count);
+    ys.resize(count);
+}
+
+bool WarpEngine::Key::operator==(const Key& other) const
+{
+    return name == other.name && srcWidth == other.srcWidth && srcHeight == other.srcHeight
+        && dstWidth == other.dstWidth && dstHeight == other.dstHeight && params == other.params;
+}
+
+std::shared_ptr<const RemapTable> WarpEngine::table(const Key& key, const RowMapper& mapper)
+{
+    TableCache& tables = cache();
+    {
+        std::lock_guard<std::mutex> lock(tables.mutex);
+        for (auto it = tables.entries.begin(); it != tables.entries.end(); ++it) {
+            if (it->key == key) {
+                tables.entries.splice(tables.entries.begin(), tables.entries, it);
+                return it->table;
+            }
+        }
+    }
+
+    // Build outside the lock so other warps are not blocked; a concurrent miss on the
+    // same key builds an identical table and the first one inserted wins
+    auto built = std::make_shared<RemapTable>(key.dstWidth, key.dstHeight);
+    ThreadPool::instance().parallelFor(0, key.dstHeight, ThreadPool::rowGrain(key.dstWidth, key.dstHeight),
+                                       [&](int y0, int y1) {
+        for (int y = y0; y < y1; ++y) {
+            mapper(y, key.dstWidth, built->xRow(y), built->yRow(y));
+        }
+    });
+
+    std::lock_guard<std::mutex> lock(tables.mutex);
+    for (const CacheEntry& entry : tables.entries) {
+        if (entry.key == key) return entry.table;
+    }
+    if (built->bytes() <= tables.limit) {
+        tables.entries.push_front({key, built});
+        tables.bytes += built->bytes();
+        tables.evictTo(tables.limit);
+    }
+    return built;
+}
+
+void WarpEngine::remapRows(const Image& src, Image& dst, const RemapTable& table, Interpolation mode,
+                           const RgbColor& background, int rowBegin, int rowEnd, Arithmetic arithmetic,
+                           EdgeMode edge)
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(std::min(dst.height, table.height()), rowEnd);
+    const int width = std::min(dst.width, table.width());
+    const bool fixed = arithmetic == Arithmetic::FixedPoint && mode == Interpolation::Bilinear;
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        unsigned char* out = dst.imageData + static_cast<std::size_t>(y) * dst.width * 3;
+        if (fixed) {
+            Sampler::samplePointsFixed(src, table.xRow(y), table.yRow(y), width, background, out, edge);
+        } else {
+            Sampler::samplePoints(src, mode, table.xRow(y), table.yRow(y), width, background, out, edge);
+        }
+    }
+}
+
+void WarpEngine::setCacheLimit(std::size_t bytes)
+{
+    TableCache& tables = cache();
+    std::lock_guard<std::mutex> lock(tables.mutex);
+    tables.limit = bytes;
+    tables.evictTo(bytes);
+}
+
+void WarpEngine::clearCache()
+{
+    TableCache& tables = cache();
+    std::lock_guard<std::mutex> lock(tables.mutex);
+    tables.entries.clear();
+    tables.bytes = 0;
+}
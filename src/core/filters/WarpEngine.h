@@ -0,0 +1,136 @@
+/**
+ * @file WarpEngine.h
+ * @brief Geometric warps driven by cached per-pixel remap tables.
+ *
+ * This file contains the declaration of the WarpEngine used by the Fish-Eye and Skew
+ * filters. A warp is described by a row mapper that writes, for every output pixel, the
+ * source coordinates it is sampled from. The engine evaluates the mapper once per
+ * (warp name, sizes, parameters) key into a RemapTable, keeps recently used tables in a
+ * process-wide cache, and applies a table with Sampler gathers in parallel row bands.
+ *
+ * @details Mappers that use expensive math (square roots, powers, divisions) therefore
+ * run once per image size: warping a batch of same-size frames costs only the gather
+ * pass after the first frame. The cache holds at most setCacheLimit() bytes of tables
+ * (256 MB by default) and evicts the least recently used first; a table that is still in
+ * use stays alive through its shared pointer even after eviction.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef WARPENGINE_H
+#define WARPENGINE_H
+
+class Image;
+#include "FilterTypes.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class RemapTable
+ * @brief Source coordinates of every pixel of a warped output image.
+ *
+ * Coordinates use the Sampler convention: (x, y) is the center of source pixel (x, y).
+ */
+class RemapTable
+{
+public:
+    /**
+     * @brief Creates an uninitialized table for an output of @p width x @p height pixels.
+     */
+    RemapTable(int width, int height);
+
+    int width() const { return tableWidth; }
+    int height() const { return tableHeight; }
+
+    float* xRow(int y) { return xs.data() + static_cast<std::size_t>(y) * tableWidth; }
+    float* yRow(int y) { return ys.data() + static_cast<std::size_t>(y) * tableWidth; }
+    const float* xRow(int y) const { return xs.data() + static_cast<std::size_t>(y) * tableWidth; }
+    const float* yRow(int y) const { return ys.data() + static_cast<std::size_t>(y) * tableWidth; }
+
+    /**
+     * @brief Memory held by the coordinates, in bytes.
+     */
+    std::size_t bytes() const { return (xs.size() + ys.size()) * sizeof(float); }
+
+private:
+    int tableWidth;
+    int tableHeight;
+    std::vector<float> xs;
+    std::vector<float> ys;
+};
+
+/**
+ * @class WarpEngine
+ * @brief Builds, caches and applies remap tables.
+ */
+class WarpEngine
+{
+public:
+    /**
+     * @brief Writes the source coordinates of the @p width pixels of output row @p y.
+     *
+     * Called concurrently for different rows, so it must be thread-safe.
+     */
+    using RowMapper = std::function<void(int y, int width, float* xs, float* ys)>;
+
+    /**
+     * @brief Identifies a table: equal keys must describe the same mapping.
+     */
+    struct Key {
+        std::string name;           ///< Warp kind, e.g. "fisheye"
+        int srcWidth = 0;
+        int srcHeight = 0;
+        int dstWidth = 0;
+        int dstHeight = 0;
+        std::vector<double> params; ///< Every parameter the mapping depends on
+
+        bool operator==(const Key& other) const;
+    };
+
+    /**
+     * @brief Returns the cached table for @p key, building it with @p mapper on a miss.
+     *
+     * Rows are evaluated in parallel on the shared thread pool.
+     *
+     * @param key Cache key; dstWidth x dstHeight is the table size
+     * @param mapper Coordinate mapping, only called on a cache miss
+     * @return Shared, immutable table
+     */
+    static std::shared_ptr<const RemapTable> table(const Key& key, const RowMapper& mapper);
+
+    /**
+     * @brief Samples rows [rowBegin, rowEnd) of @p dst from @p src through @p table.
+     * @param src Source image
+     * @param dst Destination image of the table size (must not alias @p src)
+     * @param table Remap table
+     * @param mode Interpolation mode
+     * @param background Color of samples outside the source
+     * @param rowBegin First output row
+     * @param rowEnd One past the last output row
+     * @param arithmetic FixedPoint samples Bilinear with Sampler::samplePointsFixed()
+     * @param edge Rule for taps outside the source
+     */
+    static void remapRows(const Image& src, Image& dst, const RemapTable& table, Interpolation mode,
+                          const RgbColor& background, int rowBegin, int rowEnd,
+                          Arithmetic arithmetic = Arithmetic::Reference,
+                          EdgeMode edge = EdgeMode::Constant);
+
+    /**
+     * @brief Sets the cache budget in bytes (0 disables caching) and evicts down to it.
+     */
+    static void setCacheLimit(std::size_t bytes);
+
+    /**
+     * @brief Drops every cached table.
+     */
+    static void clearCache();
+};
+
+#endif // WARPENGINE_H
@@ -0,0 +1,100 @@
+/**
+ * @file Histogram.cpp
+ * @brief Implementation of the privatized-bin parallel histogram.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "image/Histogram.h"
+#include "image/Image_Class.h"
+#include "parallel/ThreadPool.h"
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+
+namespace {
+
+/// Bins of one band; 32-bit counts hold any band of fewer than 2^32 pixels
+struct BandCounts {
+    std::uint32_t bins[4][256] = {};
+};
+
+void countRows(const Image& image, int rowBegin, int rowEnd, BandCounts& counts)
+{
+    const unsigned char* p = image.imageData + static_cast<std::size_t>(rowBegin) * image.width * 3;
+    const std::size_t pixels = static_cast<std::size_t>(rowEnd - rowBegin) * image.width;
+    for (std::size_t i = 0; i < pixels; ++i, p += 3) {
+        ++counts.bins[0][p[0]];
+        ++counts.bins[1][p[1]];
+        ++counts.bins[2][p[2]];
+        ++counts.bins[3][(p[0] + p[1] + p[2]) / 3];
+    }
+}
+
+void addCounts(Histogram& histogram, const BandCounts& counts, std::uint64_t pixels)
+{
+    Histogram::Bins* targets[4] = {&histogram.red, &histogram.green, &histogram.blue, &histogram.gray};
+    for (int c = 0; c < 4; ++c) {
+        for (int v = 0; v < 256; ++v) {
+            (*targets[c])[v] += counts.bins[c][v];
+        }
+    }
+    histogram.pixels += pixels;
+}
+
+} // namespace
+
+const Histogram::Bins& Histogram::channel(int channel) const
+{
+    switch (channel) {
+    case 0: return red;
+    case 1: return green;
+    case 2: return blue;
+    default: return gray;
+    }
+}
+
+void Histogram::addRows(const Image& image, int rowBegin, int rowEnd)
+{
+    rowBegin = std::max(0, rowBegin);
+    rowEnd = std::min(image.height, rowEnd);
+    if (rowEnd <= rowBegin) return;
+    BandCounts counts;
+    countRows(image, rowBegin, rowEnd, counts);
+    addCounts(*this, counts, static_cast<std::uint64_t>(rowEnd - rowBegin) * image.width);
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    for (int v = 0; v < 256; ++v) {
+        red[v] += other.red[v];
+        green[v] += other.green[v];
+        blue[v] += other.blue[v];
+        gray[v] += other.gray[v];
+    }
+    pixels += other.pixels;
+}
+
+Histogram Histogram::of(const Image& image)
+{
+    Histogram result;
+    std::mutex mergeMutex;
+    ThreadPool::instance().parallelFor(0, image.height, ThreadPool::rowGrain(image.width, image.height),
+                                       [&](int y0, int y1) {
+        // Private bins for the band, merged under the lock once per band
+        BandCounts counts;
+        countRows(image, y0, y1, counts);
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        addCounts(result, counts, static_cast<std::uint64_t>(y1 - y0) * image.width);
+    });
+    return result;
+}
+
+Histogram Image::histogram() const
+{
+    return Histogram::of(*this);
+}
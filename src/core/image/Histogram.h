@@ -0,0 +1,69 @@
+/**
+ * @file Histogram.h
+ * @brief Per-channel histograms of an Image, counted in parallel.
+ *
+ * This file contains the declaration of the Histogram returned by Image::histogram().
+ * It holds 256-bin counts of the red, green and blue channels and of the gray level
+ * (R + G + B) / 3 used by the Grayscale and Black & White filters, and is the input of
+ * contrast tools such as histogram equalization, CLAHE and automatic thresholds.
+ *
+ * @details Counting runs in row bands on the shared thread pool. Every band counts into
+ * its own private bins on the stack and merges them into the result once, so threads
+ * never contend on shared counters inside the pixel loop.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <array>
+#include <cstdint>
+
+class Image;
+
+/**
+ * @brief 256-bin histograms of the channels and gray level of an image.
+ *
+ * @example
+ * @code
+ * Histogram histogram = image.histogram();
+ * std::uint64_t dark = 0;
+ * for (int v = 0; v < 64; ++v) dark += histogram.gray[v];
+ * @endcode
+ */
+struct Histogram {
+    using Bins = std::array<std::uint64_t, 256>;
+
+    Bins red{};
+    Bins green{};
+    Bins blue{};
+    Bins gray{};              ///< Counts of (R + G + B) / 3
+    std::uint64_t pixels = 0; ///< Number of pixels counted
+
+    /**
+     * @brief Counts of channel @p channel: 0 red, 1 green, 2 blue, 3 gray.
+     */
+    const Bins& channel(int channel) const;
+
+    /**
+     * @brief Counts rows [rowBegin, rowEnd) of @p image into this histogram on the calling thread.
+     */
+    void addRows(const Image& image, int rowBegin, int rowEnd);
+
+    /**
+     * @brief Adds the counts of @p other.
+     */
+    void merge(const Histogram& other);
+
+    /**
+     * @brief Histogram of a whole image, counted in parallel row bands.
+     */
+    static Histogram of(const Image& image);
+};
+
+#endif // HISTOGRAM_H
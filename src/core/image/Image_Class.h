@@ -76,6 +76,7 @@ extern "C" {
 #include <exception>
 #include <cstring>
 #include <string.h>
+#include "image/Histogram.h"
 
 
 /**
@@ -107,7 +108,7 @@ extern "C" {
  *       thread-safe operations for GUI applications.
  * @see STB library for underlying image I/O implementation
  * @see ImageFilters class for image processing operations
- * @see ImageIO class for Qt-integrated file operations
+ * @see ImageIO class for validated file operations
  * 
  * @example
  * @code
@@ -284,6 +285,9 @@ public:
             std::cerr << "File Doesn't Exist" << '\n';
             throw std::invalid_argument("Invalid filename, File Does not Exist");
         }
+        // stbi_load reports the channel count stored in the file, but the
+        // buffer is always expanded to STBI_rgb interleaved pixels
+        channels = STBI_rgb;
 
         return true;
     }
@@ -394,6 +398,15 @@ public:
         imageData[(y * width + x) * channels + c] = value;
     }
 
+    /**
+     * @brief Counts the red, green, blue and gray levels of the image.
+     *
+     * Row bands are counted in parallel into private bins and merged (see Histogram).
+     *
+     * @return Histogram of every pixel.
+     */
+    Histogram histogram() const;
+
     /**
      * @brief Overloaded function call operator to access pixels.
      *
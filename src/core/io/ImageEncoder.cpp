@@ -0,0 +1,250 @@
+/**
+ * @file ImageEncoder.cpp
+ * @brief Implementation of in-memory encoding and atomic file writes.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "ImageEncoder.h"
+#include "image/Image_Class.h"
+#include "stb_image_write.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <system_error>
+
+// Defined by the STB writer implementation but not declared in its header
+extern "C" unsigned char* stbi_zlib_compress(unsigned char* data, int data_len, int* out_len, int quality);
+
+namespace {
+
+// STB keeps the PNG compression level in a global. Encoders read it under a shared
+// lock and only a request for a different level takes the exclusive lock, so
+// concurrent encodes with the same options never serialize.
+std::shared_mutex pngLevelMutex;
+
+void appendBytes(void* context, void* data, int size)
+{
+    auto* out = static_cast<std::vector<unsigned char>*>(context);
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    out->insert(out->end(), bytes, bytes + size);
+}
+
+int encodePng(std::vector<unsigned char>& out, const Image& image, int level)
+{
+    for (;;) {
+        {
+            std::shared_lock<std::shared_mutex> lock(pngLevelMutex);
+            if (stbi_write_png_compression_level == level) {
+                return stbi_write_png_to_func(appendBytes, &out, image.width, image.height, 3,
+                                              image.imageData, image.width * 3);
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(pngLevelMutex);
+        stbi_write_png_compression_level = level;
+    }
+}
+
+void appendU32(std::vector<unsigned char>& out, std::uint32_t value)
+{
+    out.push_back(static_cast<unsigned char>(value >> 24));
+    out.push_back(static_cast<unsigned char>(value >> 16));
+    out.push_back(static_cast<unsigned char>(value >> 8));
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+std::uint32_t crc32(const unsigned char* data, std::size_t size, std::uint32_t crc = 0)
+{
+    static const std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> entries{};
+        for (std::uint32_t n = 0; n < 256; ++n) {
+            std::uint32_t c = n;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            entries[n] = c;
+        }
+        return entries;
+    }();
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; ++i) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+void appendChunk(std::vector<unsigned char>& out, const char* type, const unsigned char* data, std::size_t size)
+{
+    appendU32(out, static_cast<std::uint32_t>(size));
+    const std::size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data, data + size);
+    appendU32(out, crc32(out.data() + start, size + 4));
+}
+
+/**
+ * @brief Writes an indexed-color PNG: the image's own colors as palette, the smallest
+ *        bit depth that holds them, and no row filters (best for palette data).
+ */
+int encodeIndexedPng(std::vector<unsigned char>& out, const Image& image, int level)
+{
+    // Palette lookup through a small open-addressing table, with the previous pixel cached
+    constexpr int Slots = 1024;
+    std::vector<std::uint32_t> keys(Slots);
+    std::vector<int> slotIndex(Slots, -1);
+    std::vector<std::uint32_t> palette;
+    std::vector<unsigned char> indices(static_cast<std::size_t>(image.width) * image.height);
+    std::uint32_t previousKey = 0xFFFFFFFFu;
+    unsigned char previousIndex = 0;
+    const unsigned char* p = image.imageData;
+    for (std::size_t i = 0; i < indices.size(); ++i, p += 3) {
+        const std::uint32_t key = static_cast<std::uint32_t>(p[0]) << 16 | static_cast<std::uint32_t>(p[1]) << 8 | p[2];
+        if (key != previousKey) {
+            std::uint32_t slot = (key * 2654435761u) >> 22;
+            while (slotIndex[slot] >= 0 && keys[slot] != key) slot = (slot + 1) & (Slots - 1);
+            if (slotIndex[slot] < 0) {
+                if (palette.size() == 256) {
+                    throw std::invalid_argument("PNG-8 output needs at most 256 colors; apply the quantize filter first");
+                }
+                keys[slot] = key;
+                slotIndex[slot] = static_cast<int>(palette.size());
+                palette.push_back(key);
+            }
+            previousKey = key;
+            previousIndex = static_cast<unsigned char>(slotIndex[slot]);
+        }
+        indices[i] = previousIndex;
+    }
+
+    const int depth = palette.size() <= 2 ? 1 : palette.size() <= 4 ? 2 : palette.size() <= 16 ? 4 : 8;
+    const std::size_t rowBytes = (static_cast<std::size_t>(image.width) * depth + 7) / 8;
+    std::vector<unsigned char> raw((rowBytes + 1) * image.height, 0);
+    for (int y = 0; y < image.height; ++y) {
+        unsigned char* row = raw.data() + y * (rowBytes + 1) + 1; // after the filter byte (0: none)
+        const unsigned char* in = indices.data() + static_cast<std::size_t>(y) * image.width;
+        for (int x = 0; x < image.width; ++x) {
+            const int bit = x * depth;
+            row[bit >> 3] |= static_cast<unsigned char>(in[x] << (8 - depth - (bit & 7)));
+        }
+    }
+    int compressedSize = 0;
+    unsigned char* compressed = stbi_zlib_compress(raw.data(), static_cast<int>(raw.size()), &compressedSize, level);
+    if (compressed == nullptr) return 0;
+
+    static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    out.insert(out.end(), signature, signature + 8);
+    std::vector<unsigned char> header;
+    appendU32(header, static_cast<std::uint32_t>(image.width));
+    appendU32(header, static_cast<std::uint32_t>(image.height));
+    header.insert(header.end(), {static_cast<unsigned char>(depth), 3, 0, 0, 0}); // color type 3: indexed
+    appendChunk(out, "IHDR", header.data(), header.size());
+    std::vector<unsigned char> colors;
+    for (std::uint32_t color : palette) {
+        colors.insert(colors.end(), {static_cast<unsigned char>(color >> 16), static_cast<unsigned char>(color >> 8),
+                                     static_cast<unsigned char>(color)});
+    }
+    appendChunk(out, "PLTE", colors.data(), colors.size());
+    appendChunk(out, "IDAT", compressed, static_cast<std::size_t>(compressedSize));
+    std::free(compressed);
+    appendChunk(out, "IEND", nullptr, 0);
+    return 1;
+}
+
+} // namespace
+
+std::vector<unsigned char> ImageEncoder::encode(const Image& image, ImageFormat format, const EncodeOptions& options)
+{
+    if (image.imageData == nullptr || image.width <= 0 || image.height <= 0) {
+        throw std::invalid_argument("Cannot encode an empty image");
+    }
+    if (options.jpegQuality < 1 || options.jpegQuality > 100) {
+        throw std::invalid_argument("JPEG quality must be between 1 and 100");
+    }
+    if (options.pngCompression < 0 || options.pngCompression > 9) {
+        throw std::invalid_argument("PNG compression level must be between 0 and 9");
+    }
+
+    std::vector<unsigned char> out;
+    out.reserve(static_cast<std::size_t>(image.width) * image.height * 3 / 2);
+
+    int ok = 0;
+    switch (format) {
+    case ImageFormat::Png:
+        ok = options.pngPalette ? encodeIndexedPng(out, image, options.pngCompression)
+                                : encodePng(out, image, options.pngCompression);
+        break;
+    case ImageFormat::Jpeg:
+        ok = stbi_write_jpg_to_func(appendBytes, &out, image.width, image.height, 3, image.imageData, options.jpegQuality);
+        break;
+    case ImageFormat::Bmp:
+        ok = stbi_write_bmp_to_func(appendBytes, &out, image.width, image.height, 3, image.imageData);
+        break;
+    case ImageFormat::Tga:
+        ok = stbi_write_tga_to_func(appendBytes, &out, image.width, image.height, 3, image.imageData);
+        break;
+    }
+    if (!ok) {
+        throw std::runtime_error("Image encoding failed");
+    }
+    return out;
+}
+
+std::size_t ImageEncoder::writeFile(const Image& image, const std::string& path, ImageFormat format, const EncodeOptions& options)
+{
+    if (path.empty()) {
+        throw std::invalid_argument("Empty file path");
+    }
+    const std::vector<unsigned char> data = encode(image, format, options);
+
+    const std::string partPath = path + ".part";
+    std::FILE* file = std::fopen(partPath.c_str(), "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("Cannot open " + partPath + " for writing");
+    }
+    const bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    const bool closed = std::fclose(file) == 0;
+    std::error_code ec;
+    if (!written || !closed) {
+        std::filesystem::remove(partPath, ec);
+        throw std::runtime_error("Cannot write " + path);
+    }
+    std::filesystem::rename(partPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(partPath, ec);
+        throw std::runtime_error("Cannot write " + path);
+    }
+    return data.size();
+}
+
+ImageFormat ImageEncoder::formatFromName(const std::string& name)
+{
+    std::string lower = name;
+    if (!lower.empty() && lower[0] == '.') lower.erase(0, 1);
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    if (lower == "png") return ImageFormat::Png;
+    if (lower == "jpg" || lower == "jpeg") return ImageFormat::Jpeg;
+    if (lower == "bmp") return ImageFormat::Bmp;
+    if (lower == "tga") return ImageFormat::Tga;
+    throw std::invalid_argument("Unsupported image format: " + name);
+}
+
+const char* ImageEncoder::extension(ImageFormat format)
+{
+    switch (format) {
+    case ImageFormat::Png: return ".png";
+    case ImageFormat::Jpeg: return ".jpg";
+    case ImageFormat::Bmp: return ".bmp";
+    case ImageFormat::Tga: return ".tga";
+    }
+    return ".png";
+}
@@ -0,0 +1,104 @@
+/**
+ * @file ImageEncoder.h
+ * @brief In-memory image encoding with explicit encoder options.
+ *
+ * This file contains the declaration of the ImageEncoder class, which encodes an Image
+ * to PNG, JPEG, BMP or TGA bytes through the STB writers and writes files atomically.
+ * Image::saveImage() always uses the writers' defaults; ImageEncoder exposes the JPEG
+ * quality and PNG compression level so batch tools can trade size for speed.
+ *
+ * @details The ImageEncoder class provides:
+ * - EncodeOptions whose defaults reproduce Image::saveImage() byte for byte
+ *   (JPEG quality 90, PNG compression level 8)
+ * - Indexed-color PNG (PNG-8) output for images of at most 256 colors, with 1, 2 or 4
+ *   bits per pixel when the palette is small enough
+ * - Encoding to a memory buffer, safe to call from several threads at once
+ * - File writes through a temporary file renamed into place, so an interrupted
+ *   write never leaves a truncated image behind
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef IMAGEENCODER_H
+#define IMAGEENCODER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class Image;
+
+/**
+ * @brief File formats supported by the encoder.
+ */
+enum class ImageFormat {
+    Png,
+    Jpeg,
+    Bmp,
+    Tga
+};
+
+/**
+ * @brief Encoder settings; the defaults match Image::saveImage().
+ */
+struct EncodeOptions {
+    int jpegQuality = 90;    ///< JPEG quality in [1, 100]
+    int pngCompression = 8;  ///< zlib level used for PNG in [0, 9]
+    bool pngPalette = false; ///< Write PNG as indexed color (PNG-8); the image needs at most 256 colors
+};
+
+/**
+ * @class ImageEncoder
+ * @brief Static utility class encoding images with explicit options.
+ *
+ * @example
+ * @code
+ * EncodeOptions options;
+ * options.jpegQuality = 85;
+ * ImageEncoder::writeFile(image, "out/photo.jpg", ImageFormat::Jpeg, options);
+ * @endcode
+ */
+class ImageEncoder {
+public:
+    /**
+     * @brief Encodes an image to a memory buffer.
+     * @param image Image to encode (interleaved RGB)
+     * @param format Output format
+     * @param options Encoder settings
+     * @return Encoded file contents
+     * @throws std::invalid_argument if the image is empty, an option is out of range, or
+     *         EncodeOptions::pngPalette is set for an image of more than 256 colors
+     * @throws std::runtime_error if the encoder fails
+     */
+    static std::vector<unsigned char> encode(const Image& image, ImageFormat format,
+                                             const EncodeOptions& options = EncodeOptions());
+
+    /**
+     * @brief Encodes an image and writes it to @p path atomically.
+     *
+     * The data is written to "<path>.part" and renamed over @p path once complete.
+     *
+     * @return Number of bytes written
+     * @throws std::invalid_argument as encode()
+     * @throws std::runtime_error if encoding or writing fails
+     */
+    static std::size_t writeFile(const Image& image, const std::string& path, ImageFormat format,
+                                 const EncodeOptions& options = EncodeOptions());
+
+    /**
+     * @brief Parses a format from a file extension or format name ("png", ".JPG", "jpeg", ...).
+     * @throws std::invalid_argument if the format is not supported
+     */
+    static ImageFormat formatFromName(const std::string& name);
+
+    /**
+     * @brief Returns the canonical file extension of a format, including the dot.
+     */
+    static const char* extension(ImageFormat format);
+};
+
+#endif // IMAGEENCODER_H
@@ -1,15 +1,15 @@
 /**
  * @file ImageIO.h
- * @brief Qt-integrated image file I/O operations with comprehensive error handling.
+ * @brief Image file I/O operations with comprehensive error handling.
  * 
- * This file provides a high-level interface for loading and saving images using Qt's
- * file system integration. It wraps the underlying Image class functionality with
- * proper error handling, file validation, and Qt string compatibility.
+ * This file provides a high-level interface for loading and saving images using
+ * std::filesystem for path validation. It wraps the underlying Image class functionality
+ * with proper error handling and file validation, and has no Qt dependency.
  * 
  * @details The ImageIO class provides:
  * - Safe file loading with existence and format validation
  * - Safe file saving with path validation
- * - Qt QString integration for cross-platform path handling
+ * - Plain std::string paths, usable from GUI and headless code alike
  * - Comprehensive error handling with descriptive exceptions
  * - Support for all image formats supported by the Image class
  * 
@@ -17,7 +17,7 @@
  * - File existence validation before loading
  * - Path validation for both load and save operations
  * - Exception safety with descriptive error messages
- * - Qt integration for seamless GUI application use
+ * - No GUI dependency; usable from command-line tools and servers
  * - Support for multiple image formats (PNG, JPEG, BMP, TGA)
  * 
  * @author Team Members:
@@ -34,26 +34,27 @@
 #ifndef IMAGEIO_H
 #define IMAGEIO_H
 
-#include <QString>
-#include <QFileInfo>
+#include <filesystem>
 #include <stdexcept>
+#include <string>
+#include <system_error>
 #include "../image/Image_Class.h"
 
 /**
  * @class ImageIO
- * @brief Static utility class for Qt-integrated image file I/O operations.
+ * @brief Static utility class for image file I/O operations.
  * 
- * This class provides a high-level, Qt-friendly interface for loading and saving
+ * This class provides a high-level interface for loading and saving
  * images. It handles file validation, error checking, and provides clear error
  * messages for common I/O issues.
  * 
  * @details The class uses static methods to provide a simple, stateless interface
  * for image I/O operations. All methods include comprehensive error handling and
- * validation to ensure robust operation in GUI applications.
+ * validation to ensure robust operation in GUI and headless applications.
  * 
- * @note This class is designed to work with the Image class and requires Qt 6.8.1 or later.
+ * @note This class is designed to work with the Image class.
  * @see Image class for the underlying image data structure and STB integration
- * @see QFileInfo for file system operations
+ * @see std::filesystem for file system operations
  */
 class ImageIO {
 public:
@@ -64,7 +65,7 @@ public:
      * the image using the underlying Image class. It provides comprehensive
      * error handling for common I/O issues.
      * 
-     * @param path Qt string containing the file path to load
+     * @param path File path to load (UTF-8)
      * @return Image object containing the loaded image data
      * 
      * @throws std::invalid_argument if:
@@ -76,7 +77,7 @@ public:
      * 
      * @note Supported formats: PNG, JPEG, BMP, TGA
      * @see Image::loadNewImage() for underlying loading implementation
-     * @see QFileInfo for file validation
+     * @see std::filesystem::is_regular_file() for file validation
      * 
      * @example
      * @code
@@ -88,17 +89,17 @@ public:
      * }
      * @endcode
      */
-    static Image loadFromFile(const QString& path)
+    static Image loadFromFile(const std::string& path)
     {
-        if (path.isEmpty()) {
+        if (path.empty()) {
             throw std::invalid_argument("Empty file path");
         }
-        QFileInfo fi(path);
-        if (!fi.exists() || !fi.isFile()) {
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(std::filesystem::path(path), ec)) {
             throw std::invalid_argument("File does not exist");
         }
         Image img;
-        img.loadNewImage(path.toStdString());
+        img.loadNewImage(path);
         return img;
     }
 
@@ -110,7 +111,7 @@ public:
      * comprehensive error handling.
      * 
      * @param image Const reference to the Image object to save
-     * @param path Qt string containing the file path where to save the image
+     * @param path File path where to save the image (UTF-8)
      * 
      * @throws std::invalid_argument if:
      *   - The path is empty
@@ -133,13 +134,13 @@ public:
      * }
      * @endcode
      */
-    static void saveToFile(const Image& image, const QString& path)
+    static void saveToFile(const Image& image, const std::string& path)
     {
-        if (path.isEmpty()) {
+        if (path.empty()) {
             throw std::invalid_argument("Empty file path");
         }
         Image copy = image; // saveImage is non-const in current API
-        copy.saveImage(path.toStdString());
+        copy.saveImage(path);
     }
 };
 
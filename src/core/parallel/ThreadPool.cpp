@@ -0,0 +1,177 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the shared worker pool and chunked parallel loops.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <memory>
+
+namespace {
+
+/// Shared state of one parallelFor() call
+struct LoopState {
+    int begin = 0;
+    int end = 0;
+    int grain = 1;
+    int chunkCount = 0;
+    const ThreadPool::RangeTask* body = nullptr;
+    const std::atomic<bool>* cancel = nullptr;
+
+    std::atomic<int> nextChunk{0};
+    std::atomic<int> finishedChunks{0};
+    std::atomic<int> finishedItems{0};
+    std::atomic<bool> skipped{false};
+
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+};
+
+/**
+ * @brief Claims one chunk and runs it.
+ * @return false once every chunk has been claimed
+ */
+bool runOneChunk(LoopState& state)
+{
+    const int chunk = state.nextChunk.fetch_add(1);
+    if (chunk >= state.chunkCount) return false;
+
+    const int first = state.begin + chunk * state.grain;
+    const int last = std::min(state.end, first + state.grain);
+    bool failed = false;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        failed = static_cast<bool>(state.error);
+    }
+    if (failed || (state.cancel && state.cancel->load())) {
+        state.skipped = true;
+    } else {
+        try {
+            (*state.body)(first, last);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (!state.error) state.error = std::current_exception();
+        }
+    }
+
+    state.finishedItems.fetch_add(last - first);
+    if (state.finishedChunks.fetch_add(1) + 1 == state.chunkCount) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.done.notify_all();
+    }
+    return true;
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(int workerCount)
+{
+    for (int i = 0; i < workerCount; ++i) {
+        workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::instance()
+{
+    static ThreadPool pool(std::max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1));
+    return pool;
+}
+
+void ThreadPool::workerLoop()
+{
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (stopping && tasks.empty()) return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::post(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    wakeUp.notify_one();
+}
+
+bool ThreadPool::parallelFor(int begin, int end, int grain, const RangeTask& body,
+                             const std::atomic<bool>* cancel, const ProgressTask& onProgress)
+{
+    if (end <= begin) return !(cancel && cancel->load());
+    grain = std::max(1, grain);
+
+    auto state = std::make_shared<LoopState>();
+    state->begin = begin;
+    state->end = end;
+    state->grain = grain;
+    state->chunkCount = (end - begin + grain - 1) / grain;
+    state->body = &body;
+    state->cancel = cancel;
+
+    // Helpers that start after all chunks are claimed simply return
+    const int helpers = std::min(static_cast<int>(workers.size()), state->chunkCount - 1);
+    for (int i = 0; i < helpers; ++i) {
+        post([state]() { while (runOneChunk(*state)) {} });
+    }
+
+    const int total = end - begin;
+    // The calling thread works too, one chunk at a time so it can report progress
+    while (runOneChunk(*state)) {
+        if (onProgress) onProgress(state->finishedItems.load(), total);
+    }
+
+    // Wait for chunks still running on workers, reporting progress meanwhile
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        while (state->finishedChunks.load() < state->chunkCount) {
+            state->done.wait_for(lock, std::chrono::milliseconds(15));
+            if (onProgress) {
+                lock.unlock();
+                onProgress(state->finishedItems.load(), total);
+                lock.lock();
+            }
+        }
+        if (state->error) std::rethrow_exception(state->error);
+    }
+
+    return !state->skipped.load();
+}
+
+int ThreadPool::rowGrain(int width, int height)
+{
+    const long long rowBytes = std::max(1LL, static_cast<long long>(width) * 3);
+    // Roughly 128 KiB per band keeps a band and its output in L2
+    int rows = static_cast<int>(std::max(1LL, (128LL * 1024) / rowBytes));
+    // ...but leave at least four bands per thread for load balancing
+    const int threads = instance().concurrency();
+    const int balanced = std::max(1, height / (4 * threads));
+    return std::max(1, std::min(rows, balanced));
+}
@@ -0,0 +1,131 @@
+/**
+ * @file ThreadPool.h
+ * @brief Shared worker pool with chunked parallel loops, cancellation and progress.
+ *
+ * This file contains the declaration of the ThreadPool class used by every filter to
+ * split an image into row bands and process them on all cores. The calling thread
+ * always takes part in the work, so nested parallel loops (for example a filter run
+ * from a batch worker) can never deadlock waiting for a free worker.
+ *
+ * @details The ThreadPool class provides:
+ * - A process-wide shared instance sized to the hardware concurrency
+ * - parallelFor() with dynamic chunk claiming for load balancing
+ * - Cooperative cancellation through an atomic flag checked before every chunk
+ * - Progress aggregated across workers and reported on the calling thread only,
+ *   so progress callbacks may safely touch GUI objects
+ * - Propagation of the first exception thrown by a chunk to the caller
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size worker pool running chunked parallel loops.
+ *
+ * @example
+ * @code
+ * ThreadPool& pool = ThreadPool::instance();
+ * int grain = ThreadPool::rowGrain(image.width, image.height);
+ * bool finished = pool.parallelFor(0, image.height, grain,
+ *     [&](int y0, int y1) { processRows(image, y0, y1); },
+ *     &cancelRequested,
+ *     [&](int done, int total) { progressBar->setValue(done); });
+ * @endcode
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Body of a parallel loop, called with a half-open index range.
+     */
+    using RangeTask = std::function<void(int begin, int end)>;
+
+    /**
+     * @brief Progress callback, invoked on the calling thread only.
+     */
+    using ProgressTask = std::function<void(int done, int total)>;
+
+    /**
+     * @brief Creates a pool.
+     * @param workerCount Number of background threads; the calling thread of
+     *        parallelFor() works too, so 0 yields purely serial execution
+     */
+    explicit ThreadPool(int workerCount);
+
+    /**
+     * @brief Stops and joins all workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Returns the shared pool (hardware concurrency - 1 workers).
+     */
+    static ThreadPool& instance();
+
+    /**
+     * @brief Number of threads that execute a parallel loop (workers + caller).
+     */
+    int concurrency() const { return static_cast<int>(workers.size()) + 1; }
+
+    /**
+     * @brief Runs @p body over [begin, end) split into chunks of @p grain indices.
+     *
+     * Chunks are claimed dynamically by the workers and the calling thread. The
+     * call returns once every chunk has either run or been skipped because of
+     * cancellation.
+     *
+     * @param begin First index
+     * @param end One past the last index
+     * @param grain Indices per chunk (at least 1)
+     * @param body Function processing one chunk
+     * @param cancel Optional flag; once set, chunks that have not started are skipped
+     * @param onProgress Optional callback receiving the number of finished indices
+     * @return false if the loop was cancelled before all chunks ran
+     * @throws Rethrows the first exception thrown by @p body
+     */
+    bool parallelFor(int begin, int end, int grain, const RangeTask& body,
+                     const std::atomic<bool>* cancel = nullptr,
+                     const ProgressTask& onProgress = ProgressTask());
+
+    /**
+     * @brief Picks a row-band height for an RGB image of the given size.
+     *
+     * Bands are sized to stay within a few hundred kilobytes while leaving several
+     * bands per thread for load balancing.
+     *
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @return Rows per band (at least 1)
+     */
+    static int rowGrain(int width, int height);
+
+private:
+    void workerLoop();
+    void post(std::function<void()> task);
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    bool stopping = false;
+};
+
+#endif // THREADPOOL_H
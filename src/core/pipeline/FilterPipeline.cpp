@@ -0,0 +1,336 @@
+/**
+ * @file FilterPipeline.cpp
+ * @brief Implementation of the lazily evaluated, band-fused filter pipeline.
+ *
+ * A fused pass walks the output image in horizontal bands. For each band, every
+ * stencil stage computes its output rows for the band widened by the halo that the
+ * remaining stages need, reading from the previous stage's band buffer. Only the last
+ * stage writes into the frame-sized output, so each intermediate buffer holds a band
+ * plus halo rows instead of a whole image. Bands are independent and are spread over
+ * the shared ThreadPool, each with its own intermediate buffers.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "FilterPipeline.h"
+#include "image/Image_Class.h"
+#include "parallel/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+
+namespace {
+/// Target size of one band buffer; small enough to stay resident in L2
+constexpr std::size_t kBandBufferBytes = 256 * 1024;
+}
+
+FilterPipeline& FilterPipeline::point(const PointOp& op)
+{
+    Stage stage;
+    stage.kind = StageKind::Point;
+    stage.name = "point";
+    stage.lut = op;
+    stages.push_back(std::move(stage));
+    return *this;
+}
+
+FilterPipeline& FilterPipeline::pixelOp(const std::string& name, PixelKernel kernel)
+{
+    Stage stage;
+    stage.kind = StageKind::Pixel;
+    stage.name = name;
+    stage.pixelKernel = std::move(kernel);
+    stages.push_back(std::move(stage));
+    return *this;
+}
+
+FilterPipeline& FilterPipeline::stencil(const std::string& name, int radius, StencilKernel kernel)
+{
+    Stage stage;
+    stage.kind = StageKind::Stencil;
+    stage.name = name;
+    stage.radius = std::max(0, radius);
+    stage.stencilKernel = std::move(kernel);
+    stages.push_back(std::move(stage));
+    return *this;
+}
+
+FilterPipeline& FilterPipeline::frame(const std::string& name, FrameKernel kernel)
+{
+    Stage stage;
+    stage.kind = StageKind::Frame;
+    stage.name = name;
+    stage.frameKernel = std::move(kernel);
+    stages.push_back(std::move(stage));
+    return *this;
+}
+
+FilterPipeline& FilterPipeline::grayscale()
+{
+    return pixelOp("grayscale", [](unsigned char* row, int width) {
+        for (int x = 0; x < width; ++x, row += 3) {
+            unsigned char gray = static_cast<unsigned char>((row[0] + row[1] + row[2]) / 3);
+            row[0] = row[1] = row[2] = gray;
+        }
+    });
+}
+
+FilterPipeline& FilterPipeline::blackAndWhite(int threshold)
+{
+    return pixelOp("black & white", [threshold](unsigned char* row, int width) {
+        for (int x = 0; x < width; ++x, row += 3) {
+            int gray = (row[0] + row[1] + row[2]) / 3;
+            unsigned char bw = (gray > threshold) ? 255 : 0;
+            row[0] = row[1] = row[2] = bw;
+        }
+    });
+}
+
+FilterPipeline& FilterPipeline::emboss()
+{
+    return stencil("emboss", 1, [](const unsigned char* const* rows, unsigned char* out, int width) {
+        const unsigned char* cur = rows[1];
+        const unsigned char* below = rows[2];
+        for (int x = 0; x < width; ++x) {
+            int nx = std::min(x + 1, width - 1);
+            int diffR = std::clamp(cur[x * 3 + 0] - below[nx * 3 + 0] + 128, 0, 255);
+            int diffG = std::clamp(cur[x * 3 + 1] - below[nx * 3 + 1] + 128, 0, 255);
+            int diffB = std::clamp(cur[x * 3 + 2] - below[nx * 3 + 2] + 128, 0, 255);
+            unsigned char gray = static_cast<unsigned char>((diffR + diffG + diffB) / 3);
+            out[x * 3 + 0] = out[x * 3 + 1] = out[x * 3 + 2] = gray;
+        }
+    });
+}
+
+std::vector<FilterPipeline::Pass> FilterPipeline::compile() const
+{
+    std::vector<Pass> passes;
+    Pass current;
+    bool open = false;
+
+    auto flush = [&]() {
+        if (open) passes.push_back(std::move(current));
+        current = Pass();
+        open = false;
+    };
+
+    for (const Stage& stage : stages) {
+        if (stage.kind == StageKind::Frame) {
+            flush();
+            Pass pass;
+            pass.isFrame = true;
+            pass.name = stage.name;
+            pass.frameKernel = stage.frameKernel;
+            passes.push_back(std::move(pass));
+            continue;
+        }
+
+        open = true;
+        if (stage.kind == StageKind::Stencil) {
+            StencilStep step;
+            step.name = stage.name;
+            step.radius = stage.radius;
+            step.kernel = stage.stencilKernel;
+            current.steps.push_back(std::move(step));
+            continue;
+        }
+
+        // Row-local steps run on the output of whatever precedes them in the pass
+        std::vector<RowStep>& target = current.steps.empty() ? current.pre : current.steps.back().post;
+        if (stage.kind == StageKind::Point && !target.empty() && target.back().isPoint) {
+            // Consecutive point operations collapse into a single lookup table
+            target.back().lut = target.back().lut.then(stage.lut);
+            target.back().name += "+" + stage.name;
+            continue;
+        }
+        RowStep step;
+        step.name = stage.name;
+        step.isPoint = (stage.kind == StageKind::Point);
+        step.lut = stage.lut;
+        step.kernel = stage.pixelKernel;
+        target.push_back(std::move(step));
+    }
+    flush();
+
+    // Drop point steps whose merged table turned out to be the identity
+    auto pruneIdentity = [](std::vector<RowStep>& steps) {
+        steps.erase(std::remove_if(steps.begin(), steps.end(),
+                                   [](const RowStep& s) { return s.isPoint && s.lut.isIdentity(); }),
+                    steps.end());
+    };
+    for (Pass& pass : passes) {
+        pruneIdentity(pass.pre);
+        for (StencilStep& step : pass.steps) pruneIdentity(step.post);
+    }
+    return passes;
+}
+
+int FilterPipeline::bandRowsFor(const Pass& pass, int width, int height) const
+{
+    if (bandRowsOverride > 0) return std::min(bandRowsOverride, std::max(1, height));
+
+    int totalHalo = 0;
+    for (const StencilStep& step : pass.steps) totalHalo += step.radius;
+
+    const std::size_t stride = static_cast<std::size_t>(std::max(1, width)) * 3;
+    int rows = static_cast<int>(kBandBufferBytes / stride);
+    // Keep the recomputed halo a small fraction of each band
+    rows = std::max({rows, 4 * totalHalo, 8});
+    return std::min(rows, std::max(1, height));
+}
+
+void FilterPipeline::applyRowSteps(const std::vector<RowStep>& steps, unsigned char* rows, int width, int rowCount)
+{
+    for (const RowStep& step : steps) {
+        if (step.isPoint) {
+            step.lut.applyToPixels(rows, width * rowCount);
+        } else {
+            for (int r = 0; r < rowCount; ++r) {
+                step.kernel(rows + static_cast<std::size_t>(r) * width * 3, width);
+            }
+        }
+    }
+}
+
+bool FilterPipeline::runFused(const Pass& pass, Image& image, int passIndex, int passCount,
+                              const ProgressCallback& onProgress) const
+{
+    const int width = image.width;
+    const int height = image.height;
+    const std::size_t stride = static_cast<std::size_t>(width) * 3;
+    const int total = passCount * height;
+    const int bandRows = bandRowsFor(pass, width, height);
+    const int bandCount = (height + bandRows - 1) / bandRows;
+
+    // Bands are independent and run on the shared pool; progress is reported in rows
+    std::atomic<bool> cancelled{false};
+    auto forEachBand = [&](const std::function<void(int y0, int y1)>& band) {
+        return ThreadPool::instance().parallelFor(0, bandCount, 1,
+            [&](int b0, int b1) {
+                for (int b = b0; b < b1; ++b) {
+                    band(b * bandRows, std::min(height, (b + 1) * bandRows));
+                }
+            },
+            &cancelled,
+            [&](int doneBands, int) {
+                const int done = passIndex * height + std::min(height, doneBands * bandRows);
+                if (onProgress && !onProgress(done, total)) cancelled = true;
+            });
+    };
+
+    // Row-local only: transform the image in place, band by band
+    if (pass.steps.empty()) {
+        return forEachBand([&](int y0, int y1) {
+            applyRowSteps(pass.pre, image.imageData + y0 * stride, width, y1 - y0);
+        });
+    }
+
+    const int stepCount = static_cast<int>(pass.steps.size());
+    // haloAfter[k]: extra rows step k must produce on each side of the band
+    std::vector<int> haloAfter(stepCount, 0);
+    for (int k = stepCount - 2; k >= 0; --k) {
+        haloAfter[k] = haloAfter[k + 1] + pass.steps[k + 1].radius;
+    }
+    const int inputHalo = haloAfter[0] + pass.steps[0].radius;
+
+    Image out(width, height);
+
+    const bool completed = forEachBand([&](int y0, int y1) {
+        // Band-local buffers, so concurrent bands never share intermediate rows
+        std::vector<unsigned char> preBuffer;
+        std::vector<std::vector<unsigned char>> buffers(stepCount);
+        std::vector<const unsigned char*> rowPtrs;
+
+        // Source rows for the first stencil: the image itself, or a pre-processed copy
+        int srcLo = std::max(0, y0 - inputHalo);
+        const int srcHi = std::min(height, y1 + inputHalo);
+        const unsigned char* src = image.imageData + srcLo * stride;
+        if (!pass.pre.empty()) {
+            preBuffer.assign(src, src + (srcHi - srcLo) * stride);
+            applyRowSteps(pass.pre, preBuffer.data(), width, srcHi - srcLo);
+            src = preBuffer.data();
+        }
+
+        for (int k = 0; k < stepCount; ++k) {
+            const StencilStep& step = pass.steps[k];
+            const int lo = std::max(0, y0 - haloAfter[k]);
+            const int hi = std::min(height, y1 + haloAfter[k]);
+            unsigned char* dst;
+            if (k == stepCount - 1) {
+                dst = out.imageData + lo * stride;
+            } else {
+                buffers[k].resize((hi - lo) * stride);
+                dst = buffers[k].data();
+            }
+
+            rowPtrs.assign(2 * step.radius + 1, nullptr);
+            for (int y = lo; y < hi; ++y) {
+                for (int d = -step.radius; d <= step.radius; ++d) {
+                    const int yy = std::clamp(y + d, 0, height - 1);
+                    rowPtrs[d + step.radius] = src + (yy - srcLo) * stride;
+                }
+                step.kernel(rowPtrs.data(), dst + (y - lo) * stride, width);
+            }
+            applyRowSteps(step.post, dst, width, hi - lo);
+
+            src = dst;
+            srcLo = lo;
+        }
+    });
+    if (!completed) return false;
+
+    std::swap(image.imageData, out.imageData);
+    return true;
+}
+
+bool FilterPipeline::run(Image& image, const ProgressCallback& onProgress) const
+{
+    const std::vector<Pass> passes = compile();
+    const int passCount = static_cast<int>(passes.size());
+
+    for (int i = 0; i < passCount; ++i) {
+        const Pass& pass = passes[i];
+        if (pass.isFrame) {
+            pass.frameKernel(image);
+            if (onProgress && !onProgress((i + 1) * image.height, passCount * image.height)) return false;
+            continue;
+        }
+        if (image.width <= 0 || image.height <= 0) continue;
+        if (!runFused(pass, image, i, passCount, onProgress)) return false;
+    }
+    return true;
+}
+
+std::string FilterPipeline::describeSchedule(int width) const
+{
+    auto describeRowSteps = [](const std::vector<RowStep>& steps, std::ostringstream& os) {
+        for (const RowStep& step : steps) {
+            os << " -> " << (step.isPoint ? "lut[" + step.name + "]" : step.name);
+        }
+    };
+
+    const std::vector<Pass> passes = compile();
+    std::ostringstream os;
+    for (std::size_t i = 0; i < passes.size(); ++i) {
+        const Pass& pass = passes[i];
+        os << "pass " << (i + 1) << ": ";
+        if (pass.isFrame) {
+            os << "full frame " << pass.name << "\n";
+            continue;
+        }
+        os << "fused bands of " << bandRowsFor(pass, width, 1 << 30) << " rows: input";
+        describeRowSteps(pass.pre, os);
+        for (const StencilStep& step : pass.steps) {
+            os << " -> " << step.name << " (halo " << step.radius << ")";
+            describeRowSteps(step.post, os);
+        }
+        os << "\n";
+    }
+    return os.str();
+}
@@ -0,0 +1,188 @@
+/**
+ * @file FilterPipeline.h
+ * @brief Lazily evaluated filter pipeline with pass fusion and banded execution.
+ *
+ * This file contains the declaration of the FilterPipeline class. Instead of running
+ * each filter as a separate full-frame pass, callers describe a chain of operations
+ * (point operations, row-local pixel operations, vertical stencils and full-frame
+ * operations such as geometric remaps). Nothing is computed until run() is called.
+ *
+ * @details At run time the chain is compiled into a schedule:
+ * - Consecutive point operations are composed into one lookup table
+ * - Point and pixel operations are applied in place on the band buffer of the
+ *   preceding stage, so they never allocate or traverse a frame of their own
+ * - Runs of point, pixel and stencil stages between full-frame operations are fused
+ *   into a single pass over horizontal bands; each stencil stage computes only the
+ *   rows (band plus halo) needed by the next stage, so intermediates stay in cache
+ * - Full-frame operations act as fusion barriers and run on the materialized image
+ * - Bands of a fused pass run concurrently on the shared ThreadPool, so pixel and
+ *   stencil kernels must not mutate shared state
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef FILTERPIPELINE_H
+#define FILTERPIPELINE_H
+
+class Image;
+#include <functional>
+#include <string>
+#include <vector>
+#include "filters/PointOp.h"
+
+/**
+ * @class FilterPipeline
+ * @brief A lazily evaluated chain of image operations that is fused before execution.
+ *
+ * @example
+ * @code
+ * FilterPipeline pipeline;
+ * pipeline.point(PointOp::darkAndLight(false, 20))
+ *         .grayscale()
+ *         .emboss()
+ *         .point(PointOp::invert());
+ * pipeline.run(image); // one fused banded pass
+ * @endcode
+ */
+class FilterPipeline
+{
+public:
+    /**
+     * @brief In-place operation on one row of interleaved RGB pixels.
+     * @param row Pointer to the first byte of the row
+     * @param width Number of pixels in the row
+     */
+    using PixelKernel = std::function<void(unsigned char* row, int width)>;
+
+    /**
+     * @brief Computes one output row from the 2 * radius + 1 input rows around it.
+     * @param rows Input row pointers; rows[radius] is the centre row. Rows outside the
+     *             image are clamped to the nearest edge row.
+     * @param out Output row (width * 3 bytes)
+     * @param width Number of pixels per row
+     */
+    using StencilKernel = std::function<void(const unsigned char* const* rows, unsigned char* out, int width)>;
+
+    /**
+     * @brief Operation that needs the whole image (geometric remaps, resizes, ...).
+     */
+    using FrameKernel = std::function<void(Image& image)>;
+
+    /**
+     * @brief Progress callback invoked on the calling thread as bands complete.
+     * @return false to cancel the bands that have not started yet
+     */
+    using ProgressCallback = std::function<bool(int done, int total)>;
+
+    /** @brief Appends a per-channel point operation. */
+    FilterPipeline& point(const PointOp& op);
+
+    /**
+     * @brief Appends a row-local operation that may mix channels of a pixel.
+     * @param name Name used in the schedule description
+     * @param kernel In-place row kernel
+     */
+    FilterPipeline& pixelOp(const std::string& name, PixelKernel kernel);
+
+    /**
+     * @brief Appends a stencil reading @p radius rows above and below each output row.
+     * @param name Name used in the schedule description
+     * @param radius Vertical reach of the kernel (0 for a purely horizontal kernel)
+     * @param kernel Row kernel producing one output row
+     */
+    FilterPipeline& stencil(const std::string& name, int radius, StencilKernel kernel);
+
+    /**
+     * @brief Appends a full-frame operation; this ends the current fused pass.
+     * @param name Name used in the schedule description
+     * @param kernel Operation applied to the materialized image
+     */
+    FilterPipeline& frame(const std::string& name, FrameKernel kernel);
+
+    /** @brief Appends the Grayscale filter ((R + G + B) / 3). */
+    FilterPipeline& grayscale();
+    /** @brief Appends the Black & White filter (average above @p threshold becomes white). */
+    FilterPipeline& blackAndWhite(int threshold = 127);
+    /** @brief Appends the Emboss filter (difference with the lower-right neighbour). */
+    FilterPipeline& emboss();
+
+    /** @brief Number of operations added so far. */
+    std::size_t size() const { return stages.size(); }
+    /** @brief True if no operation has been added. */
+    bool empty() const { return stages.empty(); }
+    /** @brief Removes every operation. */
+    void clear() { stages.clear(); }
+
+    /**
+     * @brief Overrides the band height used by fused passes.
+     * @param rows Rows per band; 0 restores the automatic cache-sized choice
+     */
+    void setBandRows(int rows) { bandRowsOverride = rows < 0 ? 0 : rows; }
+
+    /**
+     * @brief Describes the fused schedule that run() would execute for @p width.
+     */
+    std::string describeSchedule(int width) const;
+
+    /**
+     * @brief Evaluates the pipeline on an image in place.
+     * @param image Image to process
+     * @param onProgress Optional progress callback; returning false cancels
+     * @return false if the run was cancelled; the image contents are then
+     *         unspecified and callers should restore their saved copy
+     */
+    bool run(Image& image, const ProgressCallback& onProgress = ProgressCallback()) const;
+
+private:
+    enum class StageKind { Point, Pixel, Stencil, Frame };
+
+    struct Stage {
+        StageKind kind;
+        std::string name;
+        PointOp lut;
+        PixelKernel pixelKernel;
+        int radius = 0;
+        StencilKernel stencilKernel;
+        FrameKernel frameKernel;
+    };
+
+    /// A row-local step (merged point operation or pixel kernel)
+    struct RowStep {
+        std::string name;
+        bool isPoint = false;
+        PointOp lut;
+        PixelKernel kernel;
+    };
+
+    /// A stencil followed by the row-local steps fused into its output
+    struct StencilStep {
+        std::string name;
+        int radius = 0;
+        StencilKernel kernel;
+        std::vector<RowStep> post;
+    };
+
+    /// One unit of the compiled schedule: either a fused banded pass or a frame op
+    struct Pass {
+        bool isFrame = false;
+        std::string name;
+        FrameKernel frameKernel;
+        std::vector<RowStep> pre;       ///< Row-local steps before the first stencil
+        std::vector<StencilStep> steps; ///< Stencils with their fused epilogues
+    };
+
+    std::vector<Pass> compile() const;
+    int bandRowsFor(const Pass& pass, int width, int height) const;
+    bool runFused(const Pass& pass, Image& image, int passIndex, int passCount,
+                  const ProgressCallback& onProgress) const;
+    static void applyRowSteps(const std::vector<RowStep>& steps, unsigned char* rows, int width, int rowCount);
+
+    std::vector<Stage> stages;
+    int bandRowsOverride = 0;
+};
+
+#endif // FILTERPIPELINE_H
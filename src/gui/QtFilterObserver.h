@@ -0,0 +1,83 @@
+/**
+ * @file QtFilterObserver.h
+ * @brief Adapts the core FilterObserver interface to Qt progress and status widgets.
+ *
+ * The core filters report progress through the Qt-free FilterObserver interface. This
+ * adapter forwards those callbacks to the main window's QProgressBar and QStatusBar and
+ * processes pending Qt events so the window (and its Cancel button) stays responsive
+ * while a filter runs on the calling thread.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#ifndef QTFILTEROBSERVER_H
+#define QTFILTEROBSERVER_H
+
+#include <QApplication>
+#include <QProgressBar>
+#include <QStatusBar>
+#include <QString>
+#include "../core/filters/FilterTypes.h"
+
+/**
+ * @class QtFilterObserver
+ * @brief FilterObserver that drives a QProgressBar and a QStatusBar.
+ */
+class QtFilterObserver : public FilterObserver
+{
+public:
+    /**
+     * @brief Creates the adapter.
+     * @param progressBar Progress bar to drive (can be nullptr)
+     * @param statusBar Status bar for messages (can be nullptr)
+     */
+    QtFilterObserver(QProgressBar* progressBar, QStatusBar* statusBar)
+        : progressBar(progressBar), statusBar(statusBar)
+    {
+    }
+
+    void progressStarted(int total) override
+    {
+        if (progressBar) {
+            progressBar->setVisible(true);
+            progressBar->setRange(0, total);
+            progressBar->setValue(0);
+        }
+    }
+
+    void progressChanged(int done, int total) override
+    {
+        if (progressBar) {
+            if (progressBar->maximum() != total) {
+                progressBar->setRange(0, total);
+            }
+            progressBar->setValue(done);
+        }
+        QApplication::processEvents();
+    }
+
+    void progressFinished() override
+    {
+        if (progressBar) {
+            progressBar->setVisible(false);
+        }
+    }
+
+    void statusChanged(const std::string& message) override
+    {
+        if (statusBar) {
+            statusBar->showMessage(QString::fromStdString(message));
+        }
+        QApplication::processEvents();
+    }
+
+private:
+    QProgressBar* progressBar;  ///< Pointer to Qt progress bar for progress tracking
+    QStatusBar* statusBar;      ///< Pointer to Qt status bar for status updates
+};
+
+#endif // QTFILTEROBSERVER_H
@@ -87,6 +87,8 @@
 #include <functional>
 #include "../core/image/Image_Class.h"
 #include "../core/filters/ImageFilters.h"
+#include "../core/filters/Compositor.h"
+#include "QtFilterObserver.h"
 #include "ui_mainwindow.h"
 #include "../core/history/HistoryManager.h"
 #include "../core/io/ImageIO.h"
@@ -280,7 +282,8 @@ public:
         ui.imageLabel->installEventFilter(this);
         
         // Initialize image filters
-        imageFilters = new ImageFilters(ui.progressBar, statusBar());
+        filterObserver = new QtFilterObserver(ui.progressBar, statusBar());
+        imageFilters = new ImageFilters(filterObserver);
         
         // Initially disable filter buttons
         refreshButtons(false);
@@ -294,7 +297,7 @@ public:
      * resources and Qt objects.
      * 
      * @details The destructor:
-     * - Deletes the ImageFilters instance
+     * - Deletes the ImageFilters instance and its Qt progress adapter
      * - Qt automatically handles cleanup of child widgets
      * - Ensures proper resource deallocation
      * 
@@ -303,6 +306,7 @@ public:
      */
     ~PhotoSmith() {
         delete imageFilters;
+        delete filterObserver;
     }
 
 private slots:
@@ -589,7 +593,7 @@ private slots:
      * @details This method:
      * - Opens a file dialog for image selection
      * - Loads the selected image using the Image class
-     * - Merges the images by averaging pixel values
+     * - Blends the images by averaging pixel values or with a chosen blend mode and opacity
      * - Handles errors gracefully with user feedback
      * - Updates the display after successful merge
      * 
@@ -654,16 +658,32 @@ private slots:
                     const int targetW = std::max((int)currentImage.width, (int)mergeImage.width);
                     const int targetH = std::max((int)currentImage.height, (int)mergeImage.height);
                     if (currentImage.width != targetW || currentImage.height != targetH) {
-                        imageFilters->applyResize(currentImage, targetW, targetH);
+                        imageFilters->applyResize(currentImage, targetW, targetH, ResizeFilter::Bicubic);
                     }
                     if (mergeImage.width != targetW || mergeImage.height != targetH) {
-                        imageFilters->applyResize(mergeImage, targetW, targetH);
+                        imageFilters->applyResize(mergeImage, targetW, targetH, ResizeFilter::Bicubic);
                     }
                 }
                 // else: Merge common overlapping area by default behavior below
             }
 
-            imageFilters->applyMerge(currentImage, mergeImage);
+            const QStringList modes = QStringList() << "Average" << "Normal" << "Multiply" << "Screen"
+                                                    << "Overlay" << "Add" << "Difference";
+            const QString mode = getInputFromList("Merge Images", "Blend mode:", modes);
+            if (mode.isEmpty()) {
+                return; // user cancelled
+            }
+            if (mode == "Average") {
+                imageFilters->applyMerge(currentImage, mergeImage);
+            } else {
+                bool ok = false;
+                const int opacity = QInputDialog::getInt(this, "Merge Images", "Opacity (%):", 100, 0, 100, 1, &ok);
+                if (!ok) return;
+                CompositeOptions blend;
+                blend.mode = static_cast<BlendMode>(modes.indexOf(mode) - 1);
+                blend.opacity = opacity / 100.0;
+                imageFilters->applyMerge(currentImage, mergeImage, blend);
+            }
             updateImageDisplay();
             setActiveFilterValue("Merge");
             updatePropertiesPanel();
@@ -703,7 +723,7 @@ private slots:
             saveStateForUndo();
             
             try {
-                imageFilters->applyFlip(currentImage, choice);
+                imageFilters->applyFlip(currentImage, choice == "Horizontal" ? FlipDirection::Horizontal : FlipDirection::Vertical);
                 updateImageDisplay();
                 setActiveFilterValue("Flip");
                 updatePropertiesPanel();
@@ -721,7 +741,7 @@ private slots:
      * 
      * @details This method:
      * - Validates that an image is currently loaded
-     * - Shows a selection dialog for rotation angle
+     * - Shows a selection dialog for rotation angle, or a custom angle and canvas
      * - Saves the current state for undo functionality
      * - Applies the rotation transformation using ImageFilters
      * - Updates the display and properties panel
@@ -736,15 +756,39 @@ private slots:
         if (!hasImage) return;
         
         QStringList options;
-        options << "90°" << "180°" << "270°";
+        options << "90°" << "180°" << "270°" << "Custom angle...";
         
         QString choice = getInputFromList("Rotate Image", "Choose rotation angle:", options);
         
-        if (!choice.isEmpty()) {
+        if (choice == "Custom angle...") {
+            bool ok;
+            double degrees = QInputDialog::getDouble(this, "Rotate Image",
+                "Clockwise angle in degrees (small angles straighten scans):", 1.0, -360.0, 360.0, 2, &ok);
+            if (!ok) return;
+            QString canvas = getInputFromList("Rotate Image", "Canvas:",
+                QStringList() << "Expand to fit" << "Keep size" << "Crop to fit");
+            if (canvas.isEmpty()) return;
+            
+            saveStateForUndo();
+            try {
+                imageFilters->applyRotate(currentImage, degrees, Interpolation::Bicubic,
+                                          canvas == "Keep size" ? RotateCanvas::Original
+                                          : canvas == "Crop to fit" ? RotateCanvas::CropToFit
+                                                                    : RotateCanvas::Expand);
+                updateImageDisplay();
+                setActiveFilterValue("Rotate");
+                updatePropertiesPanel();
+            } catch (const std::exception& e) {
+                QMessageBox::critical(this, "Error", QString("Filter failed: %1").arg(e.what()));
+            }
+        } else if (!choice.isEmpty()) {
             saveStateForUndo();
             
             try {
-                imageFilters->applyRotate(currentImage, choice);
+                RotateAngle angle = (choice == "90°") ? RotateAngle::Rotate90
+                                  : (choice == "180°") ? RotateAngle::Rotate180
+                                                       : RotateAngle::Rotate270;
+                imageFilters->applyRotate(currentImage, angle);
                 updateImageDisplay();
                 setActiveFilterValue("Rotate");
                 updatePropertiesPanel();
@@ -789,7 +833,7 @@ private slots:
         if (!ok) return;
 
         runSimpleFilter([&]() {
-            imageFilters->applyDarkAndLight(currentImage, choice, percent);
+            imageFilters->applyDarkAndLight(currentImage, choice == "dark" ? LightMode::Dark : LightMode::Light, percent);
         });
         setActiveFilterValue("Dark & Light");
         ui.colorModeValue->setText("RGB");
@@ -839,7 +883,7 @@ private slots:
         
         if (!choice.isEmpty()) {
             runSimpleFilter([&]() {
-                imageFilters->applyFrame(currentImage, choice);
+                imageFilters->applyFrame(currentImage, frameStyleFromName(choice.toStdString()));
             });
             setActiveFilterValue("Frame");
             updatePropertiesPanel();
@@ -881,12 +925,13 @@ private slots:
      * @brief Resize the current image to specified dimensions.
      * 
      * Presents dialogs to the user to input new width and height values,
-     * then resizes the current image using nearest-neighbor interpolation.
+     * then resizes the current image with the chosen resampling filter.
      * 
      * @details This method:
      * - Validates that an image is currently loaded
      * - Shows input dialogs for width and height (1-10000 pixels)
      * - Uses current image dimensions as default values
+     * - Asks for the resampling filter (Lanczos, bicubic, bilinear, area or nearest)
      * - Applies resize transformation using ImageFilters
      * - Updates the display and properties panel
      * - Handles user cancellation gracefully
@@ -905,9 +950,19 @@ private slots:
         int height = QInputDialog::getInt(this, "Resize Image", "Enter new height:", 
             currentImage.height, 1, 10000, 1, &ok2);
         
-        if (ok1 && ok2) {
+        if (!ok1 || !ok2) return;
+        
+        QStringList filters;
+        filters << "Lanczos (sharpest)" << "Bicubic" << "Bilinear" << "Area (large reductions)" << "Nearest neighbor (fastest)";
+        QString choice = getInputFromList("Resize Image", "Resampling filter:", filters);
+        if (!choice.isEmpty()) {
+            const ResizeFilter filter = choice.startsWith("Lanczos") ? ResizeFilter::Lanczos
+                                      : choice == "Bicubic" ? ResizeFilter::Bicubic
+                                      : choice == "Bilinear" ? ResizeFilter::Bilinear
+                                      : choice.startsWith("Area") ? ResizeFilter::Area
+                                                                  : ResizeFilter::Nearest;
             runSimpleFilter([&]() {
-                imageFilters->applyResize(currentImage, width, height);
+                imageFilters->applyResize(currentImage, width, height, filter);
             });
             setActiveFilterValue("Resize");
             updatePropertiesPanel();
@@ -1486,8 +1541,9 @@ protected:
     QRubberBand *rubberBand = nullptr;
     QPoint cropOrigin;
     
-    // Image filters
+    // Image filters and the adapter forwarding their progress to the widgets
     ImageFilters* imageFilters;
+    QtFilterObserver* filterObserver;
 
     // Helpers
     /**
@@ -1592,7 +1648,7 @@ protected:
             "Save Image", QDir::homePath(), SAVE_FILTER);
         if (fileName.isEmpty()) return false;
         try {
-            ImageIO::saveToFile(currentImage, fileName);
+            ImageIO::saveToFile(currentImage, fileName.toStdString());
             hasUnsavedChanges = false; // Mark as saved
             statusBar()->showMessage(QString("Saved: %1").arg(QFileInfo(fileName).fileName()));
             currentFilePath = fileName;
@@ -1714,7 +1770,7 @@ protected:
     void loadImageFromPath(const QString &filePath, bool viaDrop)
     {
         try {
-            originalImage = ImageIO::loadFromFile(filePath);
+            originalImage = ImageIO::loadFromFile(filePath.toStdString());
             currentImage = originalImage;
             hasImage = true;
             finalizeSuccessfulLoad(filePath, viaDrop);
@@ -0,0 +1,113 @@
+/**
+ * @file filter_regression_tests.cpp
+ * @brief Regression checks for filter behaviour that once went wrong.
+ *
+ * Each check builds a small synthetic image, runs one filter and inspects the result.
+ * The program prints every failed check and exits non-zero if any failed; CTest runs
+ * it as the photosmith_filter_regression test.
+ *
+ * @author Photo Smith Development Team
+ * @institution Faculty of Computers and Artificial Intelligence, Cairo University
+ * @version 3.5.0
+ * @date October 19, 2026
+ * @copyright FCAI Cairo University
+ */
+
+#include "filters/ImageFilters.h"
+#include "image/Image_Class.h"
+
+#include <cstdio>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char* what)
+{
+    if (!condition) {
+        std::printf("FAILED: %s\n", what);
+        ++failures;
+    }
+}
+
+/// Image filled with one gray level
+Image flatImage(int width, int height, unsigned char level)
+{
+    Image image(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            for (int c = 0; c < 3; ++c) image(x, y, c) = level;
+        }
+    }
+    return image;
+}
+
+/// Number of black pixels, optionally only those within @p border pixels of the edge
+int countEdges(const Image& image, int border = -1)
+{
+    int count = 0;
+    for (int y = 0; y < image.height; ++y) {
+        for (int x = 0; x < image.width; ++x) {
+            const bool nearEdge = x < border || y < border || x >= image.width - border || y >= image.height - border;
+            if ((border < 0 || nearEdge) && image(x, y, 0) == 0) ++count;
+        }
+    }
+    return count;
+}
+
+/// Number of pixels whose three channels all equal @p level
+int countLevel(const Image& image, unsigned char level)
+{
+    int count = 0;
+    for (int y = 0; y < image.height; ++y) {
+        for (int x = 0; x < image.width; ++x) {
+            if (image(x, y, 0) == level && image(x, y, 1) == level && image(x, y, 2) == level) ++count;
+        }
+    }
+    return count;
+}
+
+/// Canny must not trace the image border as a contour
+void cannyIgnoresImageBorder()
+{
+    ImageFilters filters;
+    Image flat = flatImage(64, 48, 128);
+    filters.applyCanny(flat, 50, 100);
+    check(countEdges(flat) == 0, "canny on a flat image has no edge pixels");
+
+    Image disk = flatImage(64, 48, 40);
+    for (int y = 0; y < disk.height; ++y) {
+        for (int x = 0; x < disk.width; ++x) {
+            if ((x - 32) * (x - 32) + (y - 24) * (y - 24) < 15 * 15) {
+                for (int c = 0; c < 3; ++c) disk(x, y, c) = 220;
+            }
+        }
+    }
+    filters.applyCanny(disk, 50, 100);
+    check(countEdges(disk) > 0, "canny finds the contour of a disk");
+    check(countEdges(disk, 4) == 0, "canny adds no frame around a disk");
+}
+
+/// Fish-eye rim samples must not blend in a background color
+void fishEyeRimKeepsSourceColors()
+{
+    for (Arithmetic arithmetic : {Arithmetic::Reference, Arithmetic::FixedPoint}) {
+        ImageFilters filters;
+        filters.setArithmetic(arithmetic);
+        Image image = flatImage(97, 61, 20);
+        filters.applyFishEye(image);
+        check(countLevel(image, 20) == image.width * image.height,
+              arithmetic == Arithmetic::Reference ? "fish-eye keeps a flat image flat"
+                                                  : "fixed-point fish-eye keeps a flat image flat");
+    }
+}
+
+} // namespace
+
+int main()
+{
+    cannyIgnoresImageBorder();
+    fishEyeRimKeepsSourceColors();
+    if (failures == 0) std::printf("All filter regression checks passed\n");
+    return failures == 0 ? 0 : 1;
+}